@@ -70,6 +70,8 @@ my $overwrite = 0;
 
 my $bind_ip = undef;
 
+my $compression = undef;
+
 my $use_remote_ip = 'proxy';
 
 my $family = 'prefer-inet';
@@ -114,6 +116,9 @@ qq{Usage: $0 [options] [--] [user@]host [command...]
         --bind-server={ssh|any|IP}  ask the server to reply from an IP address
                                        (default: "ssh")
 
+        --compression=CODEC  compress updates with zlib, zstd or lz4,
+                                if both ends have it (default: "zlib")
+
         --ssh=COMMAND        ssh command to run when setting up session
                                 (example: "ssh -p 2222")
                                 (default: "ssh")
@@ -171,6 +176,7 @@ GetOptions( 'client=s' => \$client,
 	    'version' => \$version,
 	    'fake-proxy!' => \my $fake_proxy,
 	    'bind-server=s' => \$bind_ip,
+	    'compression=s' => \$compression,
 	    'experimental-remote-ip=s' => \$use_remote_ip) or die $usage;
 
 if ( defined $help ) {
@@ -384,6 +390,10 @@ if ( $pid == 0 ) { # child
     push @server, ( '-p', $port_request );
   }
 
+  if ( defined $compression ) {
+    push @server, ( '-z', $compression );
+  }
+
   for ( &locale_vars ) {
     push @server, ( '-l', $_ );
   }
@@ -462,7 +472,8 @@ if ( $pid == 0 ) { # child
   $ENV{ 'MOSH_KEY' } = $key;
   $ENV{ 'MOSH_PREDICTION_DISPLAY' } = $predict;
   $ENV{ 'MOSH_NO_TERM_INIT' } = '1' if !$term_init;
-  exec {$client} ("$client", "-# @cmdline |", $ip, $port);
+  my @client_options = defined $compression ? ( '-z', $compression ) : ();
+  exec {$client} ("$client", "-# @cmdline |", @client_options, $ip, $port);
 }
 
 sub shell_quote { join ' ', map {(my $a = $_) =~ s/'/'\\''/g; "'$a'"} @_ }
@@ -193,14 +193,37 @@ Nonce::Nonce( const char* s_bytes, size_t len )
 
 const std::string Session::encrypt( const Message& plaintext )
 {
-  const size_t pt_len = plaintext.text.size();
+  struct iovec iov;
+  iov.iov_base = const_cast<char*>( plaintext.text.data() );
+  iov.iov_len = plaintext.text.size();
+
+  size_t len;
+  const char* ciphertext = encrypt( plaintext.nonce, &iov, 1, &len );
+  return plaintext.nonce.cc_str() + std::string( ciphertext, len );
+}
+
+const char* Session::encrypt( const Nonce& nonce,
+                              const struct iovec* iov,
+                              int iovcnt,
+                              size_t* len,
+                              char* ciphertext )
+{
+  if ( ciphertext == NULL ) {
+    ciphertext = ciphertext_buffer.data();
+  }
+  assert( ( reinterpret_cast<uintptr_t>( ciphertext ) & 0xF ) == 0 );
+
+  size_t pt_len = 0;
+  for ( int i = 0; i < iovcnt; i++ ) {
+    assert( pt_len + iov[i].iov_len <= plaintext_buffer.len() );
+    memcpy( plaintext_buffer.data() + pt_len, iov[i].iov_base, iov[i].iov_len );
+    pt_len += iov[i].iov_len;
+  }
   const int ciphertext_len = pt_len + 16;
 
   assert( (size_t)ciphertext_len <= ciphertext_buffer.len() );
-  assert( pt_len <= plaintext_buffer.len() );
 
-  memcpy( plaintext_buffer.data(), plaintext.text.data(), pt_len );
-  memcpy( nonce_buffer.data(), plaintext.nonce.data(), Nonce::NONCE_LEN );
+  memcpy( nonce_buffer.data(), nonce.data(), Nonce::NONCE_LEN );
 
   if ( ciphertext_len
        != ae_encrypt( ctx,                      /* ctx */
@@ -209,7 +232,7 @@ const std::string Session::encrypt( const Message& plaintext )
                       pt_len,                   /* pt_len */
                       NULL,                     /* ad */
                       0,                        /* ad_len */
-                      ciphertext_buffer.data(), /* ct */
+                      ciphertext,               /* ct */
                       NULL,                     /* tag */
                       AE_FINALIZE ) ) {         /* final */
     throw CryptoException( "ae_encrypt() returned error." );
@@ -237,9 +260,8 @@ const std::string Session::encrypt( const Message& plaintext )
     throw CryptoException( "Encrypted 2^47 blocks.", true );
   }
 
-  std::string text( ciphertext_buffer.data(), ciphertext_len );
-
-  return plaintext.nonce.cc_str() + text;
+  *len = ciphertext_len;
+  return ciphertext;
 }
 
 const Message Session::decrypt( const char* str, size_t len )
@@ -248,7 +270,25 @@ const Message Session::decrypt( const char* str, size_t len )
     throw CryptoException( "Ciphertext must contain nonce and tag." );
   }
 
-  int body_len = len - 8;
+  const size_t body_len = len - 8;
+  assert( body_len <= ciphertext_buffer.len() );
+
+  Nonce nonce( str, 8 );
+  memcpy( ciphertext_buffer.data(), str + 8, body_len );
+
+  const size_t pt_len = decrypt( nonce, ciphertext_buffer.data(), body_len );
+
+  const Message ret( nonce, std::string( ciphertext_buffer.data(), pt_len ) );
+
+  return ret;
+}
+
+size_t Session::decrypt( const Nonce& nonce, char* body, size_t body_len )
+{
+  if ( body_len < 16 ) {
+    throw CryptoException( "Ciphertext must contain nonce and tag." );
+  }
+
   int pt_len = body_len - 16;
 
   if ( pt_len < 0 ) { /* super-assertion that pt_len does not equal AE_INVALID */
@@ -256,29 +296,26 @@ const Message Session::decrypt( const char* str, size_t len )
     exit( 1 );
   }
 
-  assert( (size_t)body_len <= ciphertext_buffer.len() );
-  assert( (size_t)pt_len <= plaintext_buffer.len() );
+  assert( ( reinterpret_cast<uintptr_t>( body ) & 0xF ) == 0 );
+  assert( body_len <= (size_t)RECEIVE_MTU );
 
-  Nonce nonce( str, 8 );
-  memcpy( ciphertext_buffer.data(), str + 8, body_len );
   memcpy( nonce_buffer.data(), nonce.data(), Nonce::NONCE_LEN );
 
+  /* both OCB implementations read each block before overwriting it */
   if ( pt_len
-       != ae_decrypt( ctx,                      /* ctx */
-                      nonce_buffer.data(),      /* nonce */
-                      ciphertext_buffer.data(), /* ct */
-                      body_len,                 /* ct_len */
-                      NULL,                     /* ad */
-                      0,                        /* ad_len */
-                      plaintext_buffer.data(),  /* pt */
-                      NULL,                     /* tag */
-                      AE_FINALIZE ) ) {         /* final */
+       != ae_decrypt( ctx,                 /* ctx */
+                      nonce_buffer.data(), /* nonce */
+                      body,                /* ct */
+                      body_len,            /* ct_len */
+                      NULL,                /* ad */
+                      0,                   /* ad_len */
+                      body,                /* pt */
+                      NULL,                /* tag */
+                      AE_FINALIZE ) ) {    /* final */
     throw CryptoException( "Packet failed integrity check." );
   }
 
-  const Message ret( nonce, std::string( plaintext_buffer.data(), pt_len ) );
-
-  return ret;
+  return pt_len;
 }
 
 static rlim_t saved_core_rlimit;
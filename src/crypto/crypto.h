@@ -41,6 +41,8 @@
 #include <exception>
 #include <string>
 
+#include <sys/uio.h>
+
 long int myatoi( const char* str );
 
 class PRNG;
@@ -149,7 +151,21 @@ public:
   ~Session();
 
   const std::string encrypt( const Message& plaintext );
+  /* Encrypt the concatenation of iovcnt buffers, gathered straight into the
+     plaintext buffer.  Returns the ciphertext, to be sent after
+     Nonce::cc_str(), in storage owned by the Session and valid until the
+     next encrypt() -- or in ciphertext, which must be 16-byte aligned
+     and RECEIVE_MTU long, if given. */
+  const char* encrypt( const Nonce& nonce,
+                       const struct iovec* iov,
+                       int iovcnt,
+                       size_t* len,
+                       char* ciphertext = NULL );
   const Message decrypt( const char* str, size_t len );
+  /* Decrypt in place the ciphertext that follows the nonce in a
+     datagram.  body must be 16-byte aligned; the plaintext overwrites
+     its start.  Returns the plaintext length. */
+  size_t decrypt( const Nonce& nonce, char* body, size_t body_len );
   const Message decrypt( const std::string& ciphertext ) { return decrypt( ciphertext.data(), ciphertext.size() ); }
 
   Session( const Session& );
@@ -33,6 +33,7 @@
 #include "src/include/config.h"
 
 #include <cerrno>
+#include <chrono>
 #include <climits>
 #include <clocale>
 #include <csignal>
@@ -41,6 +42,7 @@
 #include <cstring>
 #include <ctime>
 #include <exception>
+#include <string>
 
 #include <pwd.h>
 #include <sys/ioctl.h>
@@ -64,6 +66,42 @@ const int ITERATIONS = 100000;
 
 using namespace Terminal;
 
+/* Repaint a screenful of changing, colorful text each frame, and time
+   new_frame() painting rows one after another and in parallel bands. */
+static void fullscreen_benchmark( int iterations, int width, int height )
+{
+  Complete local_terminal( width, height );
+  Display display( true );
+  double seconds[2] = { 0, 0 };
+  size_t bytes[2] = { 0, 0 };
+
+  for ( int i = 0; i < iterations; i++ ) {
+    const Framebuffer last( local_terminal.get_fb() );
+
+    std::string screen( "\033[H" );
+    for ( int cell = 0; cell < width * height; cell++ ) {
+      if ( cell % 7 == 0 ) {
+        screen.append( "\033[" + std::to_string( 31 + ( cell + i ) % 7 ) + "m" );
+      }
+      screen.append( 1, 'a' + ( cell * 31 + i ) % 26 );
+    }
+    local_terminal.act( screen );
+    const Framebuffer& f = local_terminal.get_fb();
+
+    for ( int parallel = 0; parallel < 2; parallel++ ) {
+      Display::set_parallel_threshold( parallel ? 0 : INT_MAX );
+      const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      const std::string diff( display.new_frame( true, last, f ) );
+      seconds[parallel] += std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+      bytes[parallel] += diff.size();
+    }
+  }
+
+  printf( "%dx%d, %d frames\n", width, height, iterations );
+  printf( "serial:   %.3f ms/frame, %zu bytes\n", 1000 * seconds[0] / iterations, bytes[0] );
+  printf( "parallel: %.3f ms/frame, %zu bytes\n", 1000 * seconds[1] / iterations, bytes[1] );
+}
+
 int main( int argc, char** argv )
 {
   try {
@@ -85,6 +123,20 @@ int main( int argc, char** argv )
         exit( 1 );
       }
     }
+
+    /* Adopt native locale */
+    set_native_locale();
+    fatal_assert( is_utf8_locale() );
+
+    if ( argc > 4 ) {
+      if ( strcmp( argv[4], "fullscreen" ) ) {
+        fprintf( stderr, "Usage: %s [iterations [width height [fullscreen]]]\n", argv[0] );
+        exit( 1 );
+      }
+      fullscreen_benchmark( iterations, width, height );
+      return 0;
+    }
+
     Framebuffer local_framebuffers[2] = { Framebuffer( width, height ), Framebuffer( width, height ) };
     Framebuffer* local_framebuffer = &( local_framebuffers[fbmod] );
     Framebuffer* new_state = &( local_framebuffers[!fbmod] );
@@ -92,10 +144,6 @@ int main( int argc, char** argv )
     Display display( true );
     Complete local_terminal( width, height );
 
-    /* Adopt native locale */
-    set_native_locale();
-    fatal_assert( is_utf8_locale() );
-
     for ( int i = 0; i < iterations; i++ ) {
       /* type a character */
       overlays.get_prediction_engine().new_user_byte( i + 'x', *local_framebuffer );
@@ -0,0 +1,219 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include "src/include/config.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include <getopt.h>
+
+#include "src/network/compressor.h"
+#include "src/network/network.h"
+#include "src/protobufs/transportinstruction.pb.h"
+#include "src/statesync/completeterminal.h"
+#include "src/statesync/user.h"
+#include "src/util/fatal_assert.h"
+#include "src/util/locale_utils.h"
+
+/* Replays recorded sessions (e.g. from script(1)) through the terminal
+   and measures bytes per frame and speed for each compression codec. */
+
+using namespace Network;
+
+struct Method
+{
+  const char* label;
+  const char* codec;
+  uint32_t remote_capabilities;
+};
+
+static const Method methods[] = { { "zlib", "zlib", 0 },
+                                  { "zlib+dict", "zlib", CAPABILITY_DEFLATE_DICTIONARY },
+                                  { "zlib+store", "zlib", CAPABILITY_DEFLATE_DICTIONARY | CAPABILITY_STORED },
+                                  { "zstd", "zstd", CAPABILITY_ZSTD },
+                                  { "lz4", "lz4", CAPABILITY_LZ4 } };
+static const size_t method_count = sizeof( methods ) / sizeof( methods[0] );
+
+class Tally
+{
+public:
+  size_t frames;
+  size_t raw;
+  size_t compressed[method_count];
+  double compress_seconds[method_count];
+  double uncompress_seconds[method_count];
+
+  Tally() : frames( 0 ), raw( 0 ), compressed(), compress_seconds(), uncompress_seconds() {}
+
+  void add( const std::string& diff )
+  {
+    TransportBuffers::Instruction inst;
+    inst.set_protocol_version( MOSH_PROTOCOL_VERSION );
+    inst.set_old_num( frames );
+    inst.set_new_num( frames + 1 );
+    inst.set_ack_num( frames );
+    inst.set_throwaway_num( frames );
+    inst.set_diff( diff );
+    inst.set_capabilities( get_compressor().capabilities() );
+    const std::string serialized = inst.SerializeAsString();
+
+    Compressor& compressor = get_compressor();
+    for ( size_t i = 0; i < method_count; i++ ) {
+      if ( !compressor.set_preference( methods[i].codec ) ) {
+        continue;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      const std::string payload = compressor.compress_str( serialized, methods[i].remote_capabilities );
+      const auto middle = std::chrono::steady_clock::now();
+      const std::string roundtrip = compressor.uncompress_str( payload );
+      const auto end = std::chrono::steady_clock::now();
+      fatal_assert( roundtrip == serialized );
+
+      compressed[i] += payload.size();
+      compress_seconds[i] += std::chrono::duration<double>( middle - start ).count();
+      uncompress_seconds[i] += std::chrono::duration<double>( end - middle ).count();
+    }
+
+    frames++;
+    raw += serialized.size();
+  }
+
+  void print( const char* name ) const
+  {
+    if ( frames == 0 ) {
+      return;
+    }
+    printf( "%s: %zu frames, %.1f raw bytes/frame\n", name, frames, double( raw ) / frames );
+    for ( size_t i = 0; i < method_count; i++ ) {
+      if ( !get_compressor().set_preference( methods[i].codec ) ) {
+        printf( "  %-10s not built in\n", methods[i].label );
+        continue;
+      }
+      printf( "  %-10s %8.1f bytes/frame, ratio %5.2f, compress %6.1f ns/byte, uncompress %6.1f ns/byte\n",
+              methods[i].label,
+              double( compressed[i] ) / frames,
+              double( raw ) / compressed[i],
+              1e9 * compress_seconds[i] / raw,
+              1e9 * uncompress_seconds[i] / raw );
+    }
+  }
+};
+
+static void usage( const char* argv0 )
+{
+  fprintf( stderr, "Usage: %s [-w width] [-h height] [-c chunk] [-d] [-k] file...\n", argv0 );
+  fprintf( stderr, "  -c  bytes of recorded output per frame (default 1024)\n" );
+  fprintf( stderr, "  -d  send structured cell diffs instead of escape sequences\n" );
+  fprintf( stderr, "  -k  treat the files as typed input, one keystroke per frame\n" );
+}
+
+int main( int argc, char** argv )
+{
+  int width = 80, height = 24;
+  size_t chunk = 1024;
+  bool cell_diff = false, keystrokes = false;
+
+  int opt;
+  while ( ( opt = getopt( argc, argv, "w:h:c:dk" ) ) != -1 ) {
+    switch ( opt ) {
+      case 'w':
+        width = atoi( optarg );
+        break;
+      case 'h':
+        height = atoi( optarg );
+        break;
+      case 'c':
+        chunk = atoi( optarg );
+        break;
+      case 'd':
+        cell_diff = true;
+        break;
+      case 'k':
+        keystrokes = true;
+        break;
+      default:
+        usage( argv[0] );
+        return 1;
+    }
+  }
+  if ( ( optind >= argc ) || ( width < 1 ) || ( width > 1000 ) || ( height < 1 ) || ( height > 1000 )
+       || ( chunk < 1 ) ) {
+    usage( argv[0] );
+    return 1;
+  }
+
+  set_native_locale();
+  fatal_assert( is_utf8_locale() );
+
+  try {
+    Tally total;
+    for ( int i = optind; i < argc; i++ ) {
+      std::ifstream file( argv[i], std::ios::binary );
+      if ( !file ) {
+        perror( argv[i] );
+        return 1;
+      }
+      const std::string recording( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+
+      Tally tally;
+      if ( keystrokes ) {
+        for ( std::string::const_iterator c = recording.begin(); c != recording.end(); c++ ) {
+          UserStream typed;
+          typed.push_back( Parser::UserByte( *c ) );
+          tally.add( typed.diff_from( UserStream() ) );
+          total.add( typed.diff_from( UserStream() ) );
+        }
+      } else {
+        Terminal::Complete terminal( width, height );
+        terminal.set_cell_diff( cell_diff );
+        for ( size_t offset = 0; offset < recording.size(); offset += chunk ) {
+          const Terminal::Complete previous( terminal );
+          terminal.act( recording.substr( offset, chunk ) );
+          tally.add( terminal.diff_from( previous ) );
+          total.add( terminal.diff_from( previous ) );
+        }
+      }
+      tally.print( argv[i] );
+    }
+    total.print( "total" );
+  } catch ( const std::exception& e ) {
+    fprintf( stderr, "Exception caught: %s\n", e.what() );
+    return 1;
+  }
+  return 0;
+}
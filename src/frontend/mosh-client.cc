@@ -38,6 +38,7 @@
 #include <unistd.h>
 
 #include "src/crypto/crypto.h"
+#include "src/network/compressor.h"
 #include "src/util/fatal_assert.h"
 #include "src/util/locale_utils.h"
 #include "stmclient.h"
@@ -85,7 +86,7 @@ static void print_usage( FILE* file, const char* argv0 )
 {
   print_version( file );
   fprintf( file,
-           "\nUsage: %s [-# 'ARGS'] IP PORT\n"
+           "\nUsage: %s [-# 'ARGS'] [-z CODEC] IP PORT\n"
            "       %s -c\n",
            argv0,
            argv0 );
@@ -108,6 +109,7 @@ static void print_colorcount( void )
 int main( int argc, char* argv[] )
 {
   unsigned int verbose = 0;
+  const char* compression = NULL;
   /* For security, make sure we don't dump core */
   Crypto::disable_dumping_core();
 
@@ -127,7 +129,7 @@ int main( int argc, char* argv[] )
   }
 
   int opt;
-  while ( ( opt = getopt( argc, argv, "#:cv" ) ) != -1 ) {
+  while ( ( opt = getopt( argc, argv, "#:cvz:" ) ) != -1 ) {
     switch ( opt ) {
       case '#':
         // Ignore the original arguments to mosh wrapper
@@ -139,6 +141,9 @@ int main( int argc, char* argv[] )
       case 'v':
         verbose++;
         break;
+      case 'z':
+        compression = optarg;
+        break;
       default:
         print_usage( stderr, argv[0] );
         exit( 1 );
@@ -178,6 +183,18 @@ int main( int argc, char* argv[] )
   char* predict_overwrite = getenv( "MOSH_PREDICTION_OVERWRITE" );
   /* can be NULL */
 
+  /* Read compression preference; -z overrides the environment */
+  if ( !compression ) {
+    compression = getenv( "MOSH_COMPRESSION" );
+  }
+  if ( compression && *compression && !Network::get_compressor().set_preference( compression ) ) {
+    fprintf( stderr, "Compression codec %s not available, using zlib\n", compression );
+  }
+
+  /* Read multipath preference */
+  char* multipath = getenv( "MOSH_MULTIPATH" );
+  /* can be NULL */
+
   std::string key( env_key );
 
   if ( unsetenv( "MOSH_KEY" ) < 0 ) {
@@ -190,7 +207,7 @@ int main( int argc, char* argv[] )
 
   bool success = false;
   try {
-    STMClient client( ip, desired_port, key.c_str(), predict_mode, verbose, predict_overwrite );
+    STMClient client( ip, desired_port, key.c_str(), predict_mode, verbose, predict_overwrite, multipath );
     client.init();
 
     try {
@@ -93,6 +93,7 @@
 #define _PATH_BSHELL "/bin/sh"
 #endif
 
+#include "src/network/compressor.h"
 #include "src/network/networktransport-impl.h"
 
 using ServerConnection = Network::Transport<Terminal::Complete, Network::UserStream>;
@@ -125,7 +126,8 @@ static void print_version( FILE* file )
 static void print_usage( FILE* stream, const char* argv0 )
 {
   fprintf( stream,
-           "Usage: %s new [-s] [-v] [-i LOCALADDR] [-p PORT[:PORT2]] [-c COLORS] [-l NAME=VALUE] [-- COMMAND...]\n",
+           "Usage: %s new [-s] [-v] [-i LOCALADDR] [-p PORT[:PORT2]] [-c COLORS] [-z CODEC] [-l NAME=VALUE] "
+           "[-- COMMAND...]\n",
            argv0 );
 }
 
@@ -189,6 +191,7 @@ int main( int argc, char* argv[] )
   std::string command_path;
   char** command_argv = NULL;
   int colors = 0;
+  const char* compression = NULL;
   unsigned int verbose = 0; /* don't close stdin/stdout/stderr */
   /* Will cause mosh-server not to correctly detach on old versions of sshd. */
   std::list<std::string> locale_vars;
@@ -216,7 +219,7 @@ int main( int argc, char* argv[] )
   if ( ( argc >= 2 ) && ( strcmp( argv[1], "new" ) == 0 ) ) {
     /* new option syntax */
     int opt;
-    while ( ( opt = getopt( argc - 1, argv + 1, "@:i:p:c:svl:" ) ) != -1 ) {
+    while ( ( opt = getopt( argc - 1, argv + 1, "@:i:p:c:z:svl:" ) ) != -1 ) {
       switch ( opt ) {
           /*
            * This undocumented option does nothing but eat its argument.
@@ -251,6 +254,9 @@ int main( int argc, char* argv[] )
             exit( 1 );
           }
           break;
+        case 'z':
+          compression = optarg;
+          break;
         case 'v':
           verbose++;
           break;
@@ -284,6 +290,14 @@ int main( int argc, char* argv[] )
     exit( 1 );
   }
 
+  /* get preferred compression codec; -z overrides the environment */
+  if ( !compression ) {
+    compression = getenv( "MOSH_COMPRESSION" );
+  }
+  if ( compression && *compression && !Network::get_compressor().set_preference( compression ) ) {
+    fprintf( stderr, "Compression codec %s not available, using zlib\n", compression );
+  }
+
   bool with_motd = false;
 
 #ifdef HAVE_SYSLOG
@@ -664,6 +678,10 @@ static int run_server( const char* desired_ip,
     utempter_remove_record( master );
 #endif
 
+    if ( verbose ) {
+      Terminal::Display::print_strategy_stats( stderr );
+    }
+
     if ( close( master ) < 0 ) {
       perror( "close" );
       exit( 1 );
@@ -758,10 +776,17 @@ static void serve( int host_fd,
       uint64_t time_since_remote_state = now - network.get_latest_remote_state().timestamp;
       std::string terminal_to_host;
 
-      if ( sel.read( network_fd ) ) {
-        /* packet received from the network */
+      if ( sel.read( network_fd ) || network.has_queued_datagrams() ) {
+        /* packets received from the network */
         network.recv();
 
+        /* switch to structured screen updates once the client asks for them */
+        if ( !terminal.get_cell_diff() && ( network.get_remote_capabilities() & Network::CAPABILITY_CELL_DIFF )
+             && !network.shutdown_in_progress() ) {
+          terminal.set_cell_diff( true );
+          network.set_current_state( terminal );
+        }
+
         /* is new user input available for the terminal? */
         if ( network.get_remote_state_num() != last_remote_num ) {
           last_remote_num = network.get_remote_state_num();
@@ -769,31 +794,31 @@ static void serve( int host_fd,
           Network::UserStream us;
           us.apply_string( network.get_remote_diff() );
           /* apply userstream to terminal */
-          for ( size_t i = 0; i < us.size(); i++ ) {
-            const Parser::Action& action = us.get_action( i );
-            if ( typeid( action ) == typeid( Parser::Resize ) ) {
-              /* apply only the last consecutive Resize action */
-              if ( i < us.size() - 1 ) {
-                const Parser::Action& next = us.get_action( i + 1 );
-                if ( typeid( next ) == typeid( Parser::Resize ) ) {
-                  continue;
-                }
-              }
-              /* tell child process of resize */
-              const Parser::Resize& res = static_cast<const Parser::Resize&>( action );
-              struct winsize window_size;
-              if ( ioctl( host_fd, TIOCGWINSZ, &window_size ) < 0 ) {
-                perror( "ioctl TIOCGWINSZ" );
-                network.start_shutdown();
-              }
-              window_size.ws_col = res.width;
-              window_size.ws_row = res.height;
-              if ( ioctl( host_fd, TIOCSWINSZ, &window_size ) < 0 ) {
-                perror( "ioctl TIOCSWINSZ" );
-                network.start_shutdown();
-              }
+          for ( size_t i = 0; i < us.chunk_count(); i++ ) {
+            const Network::UserChunk& chunk = us.get_chunk( i );
+            if ( chunk.type == Network::UserByteType ) {
+              terminal_to_host += terminal.act_userbytes( chunk.bytes );
+              continue;
+            }
+
+            /* apply only the last consecutive Resize action */
+            if ( ( i < us.chunk_count() - 1 ) && ( us.get_chunk( i + 1 ).type == Network::ResizeType ) ) {
+              continue;
+            }
+            /* tell child process of resize */
+            const Parser::Resize& res = chunk.resize;
+            struct winsize window_size;
+            if ( ioctl( host_fd, TIOCGWINSZ, &window_size ) < 0 ) {
+              perror( "ioctl TIOCGWINSZ" );
+              network.start_shutdown();
+            }
+            window_size.ws_col = res.width;
+            window_size.ws_row = res.height;
+            if ( ioctl( host_fd, TIOCSWINSZ, &window_size ) < 0 ) {
+              perror( "ioctl TIOCSWINSZ" );
+              network.start_shutdown();
             }
-            terminal_to_host += terminal.act( action );
+            terminal_to_host += terminal.act( res );
           }
 
           if ( !us.empty() ) {
@@ -878,8 +903,9 @@ static void serve( int host_fd,
         }
       }
 
-      /* write user input and terminal writeback to the host */
-      if ( swrite( host_fd, terminal_to_host.c_str(), terminal_to_host.length() ) < 0 ) {
+      /* write user input and terminal writeback to the host in one go */
+      if ( ( !terminal_to_host.empty() )
+           && ( swrite( host_fd, terminal_to_host.c_str(), terminal_to_host.length() ) < 0 ) ) {
         network.start_shutdown();
       }
 
@@ -231,6 +231,23 @@ void STMClient::shutdown( void )
            "mosh-server process may still be running on the server.\n",
            stderr );
   }
+
+  if ( verbose && network && ( network->get_connection().get_path_count() > 1 ) ) {
+    const Network::Connection& connection = network->get_connection();
+    for ( int n = 0; n < connection.get_path_count(); n++ ) {
+      const Network::Connection::PathStats& path = connection.get_path_stats( n );
+      fprintf( stderr,
+               "Path %s: %llu datagrams received, SRTT %.0f ms, loss %.1f%%.\n",
+               connection.get_path_name( n ).c_str(),
+               static_cast<unsigned long long>( path.received ),
+               path.SRTT,
+               100 * path.loss );
+    }
+  }
+
+  if ( verbose ) {
+    Terminal::Display::print_strategy_stats( stderr );
+  }
 }
 
 void STMClient::main_init( void )
@@ -262,8 +279,23 @@ void STMClient::main_init( void )
   Terminal::Complete local_terminal( window_size.ws_col, window_size.ws_row );
   network = NetworkPointer( new NetworkType( blank, local_terminal, key.c_str(), ip.c_str(), port.c_str() ) );
 
+  /* more paths to the server, from other local interfaces */
+  for ( size_t start = 0; start < multipath.size(); ) {
+    size_t end = multipath.find( ',', start );
+    if ( end == std::string::npos ) {
+      end = multipath.size();
+    }
+    if ( end > start ) {
+      network->add_path( multipath.substr( start, end - start ) );
+    }
+    start = end + 1;
+  }
+
   network->set_send_delay( 1 ); /* minimal delay on outgoing keystrokes */
 
+  /* we can apply screen updates sent as data */
+  network->set_capabilities( Network::CAPABILITY_CELL_DIFF );
+
   /* tell server the size of the terminal */
   network->get_current_state().push_back( Parser::Resize( window_size.ws_col, window_size.ws_row ) );
 
@@ -473,12 +505,13 @@ bool STMClient::main( void )
         break;
       }
 
-      bool network_ready_to_read = false;
+      /* datagrams left over from an exception are processed without waiting for more */
+      bool network_ready_to_read = network->has_queued_datagrams();
 
       for ( std::vector<int>::const_iterator it = fd_list.begin(); it != fd_list.end(); it++ ) {
         if ( sel.read( *it ) ) {
           /* packet received from the network */
-          /* we only read one socket each run */
+          /* recv() drains every socket at once */
           network_ready_to_read = true;
         }
       }
@@ -50,6 +50,7 @@ private:
   std::string ip;
   std::string port;
   std::string key;
+  std::string multipath; /* local addresses or interfaces, comma-separated */
 
   int escape_key;
   int escape_pass_key;
@@ -94,8 +95,10 @@ public:
              const char* s_key,
              const char* predict_mode,
              unsigned int s_verbose,
-             const char* predict_overwrite )
-    : ip( s_ip ? s_ip : "" ), port( s_port ? s_port : "" ), key( s_key ? s_key : "" ), escape_key( 0x1E ),
+             const char* predict_overwrite,
+             const char* s_multipath )
+    : ip( s_ip ? s_ip : "" ), port( s_port ? s_port : "" ), key( s_key ? s_key : "" ),
+      multipath( s_multipath ? s_multipath : "" ), escape_key( 0x1E ),
       escape_pass_key( '^' ), escape_pass_key2( '^' ), escape_requires_lf( false ), escape_key_help( L"?" ),
       saved_termios(), raw_termios(), window_size(), local_framebuffer( 1, 1 ), new_state( 1, 1 ), overlays(),
       network(), display( true ) /* use TERM environment var to initialize display */, connecting_notification(),
@@ -0,0 +1,130 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include "src/include/config.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <sys/socket.h>
+#include <unistd.h>
+#ifdef HAVE_LINUX_RTNETLINK_H
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#endif
+
+#include "src/network/addressmonitor.h"
+
+using namespace Network;
+
+AddressMonitor::~AddressMonitor()
+{
+  if ( fd >= 0 ) {
+    close( fd );
+  }
+}
+
+void AddressMonitor::start( int s_family )
+{
+#ifdef HAVE_LINUX_RTNETLINK_H
+  family = s_family;
+  fd = socket( AF_NETLINK, SOCK_RAW, NETLINK_ROUTE );
+  if ( fd < 0 ) {
+    return;
+  }
+
+  struct sockaddr_nl local;
+  memset( &local, 0, sizeof( local ) );
+  local.nl_family = AF_NETLINK;
+  local.nl_groups = ( family == AF_INET6 ) ? ( RTMGRP_IPV6_IFADDR | RTMGRP_IPV6_ROUTE )
+                                           : ( RTMGRP_IPV4_IFADDR | RTMGRP_IPV4_ROUTE );
+  if ( bind( fd, reinterpret_cast<struct sockaddr*>( &local ), sizeof( local ) ) < 0 ) {
+    close( fd );
+    fd = -1;
+  }
+#else
+  (void)s_family;
+#endif
+}
+
+AddressMonitor::Event AddressMonitor::read( void )
+{
+  Event event = NONE;
+#ifdef HAVE_LINUX_RTNETLINK_H
+  if ( fd < 0 ) {
+    return event;
+  }
+
+  union {
+    char buf[8192];
+    struct nlmsghdr align;
+  } u;
+  while ( true ) {
+    ssize_t len = recv( fd, u.buf, sizeof( u.buf ), MSG_DONTWAIT );
+    if ( len < 0 ) {
+      if ( errno == ENOBUFS ) { /* notifications were dropped, so anything may have changed */
+        event = CHANGE;
+        continue;
+      }
+      break;
+    }
+    if ( event == NONE ) {
+      event = OTHER;
+    }
+
+    for ( struct nlmsghdr* nh = &u.align; NLMSG_OK( nh, len ); nh = NLMSG_NEXT( nh, len ) ) {
+      switch ( nh->nlmsg_type ) {
+        case RTM_NEWADDR:
+        case RTM_DELADDR: {
+          const struct ifaddrmsg* ifa = static_cast<const struct ifaddrmsg*>( NLMSG_DATA( nh ) );
+          if ( ( ifa->ifa_family == family ) && ( ifa->ifa_scope != RT_SCOPE_HOST )
+               && ( ifa->ifa_scope != RT_SCOPE_LINK ) ) {
+            event = CHANGE;
+          }
+          break;
+        }
+        case RTM_NEWROUTE:
+        case RTM_DELROUTE: {
+          const struct rtmsg* rt = static_cast<const struct rtmsg*>( NLMSG_DATA( nh ) );
+          if ( ( rt->rtm_family == family ) && ( rt->rtm_table == RT_TABLE_MAIN ) && ( rt->rtm_dst_len == 0 ) ) {
+            event = CHANGE;
+          }
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+#endif
+  return event;
+}
@@ -0,0 +1,76 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#ifndef ADDRESS_MONITOR_HPP
+#define ADDRESS_MONITOR_HPP
+
+namespace Network {
+/* Watches this host's addresses and default routes, through rtnetlink
+   on Linux, so that a client can move to a new address as soon as it
+   appears, instead of after PORT_HOP_INTERVAL without a round trip.
+   Elsewhere it watches nothing.
+
+   Loopback and link-local addresses, and addresses and routes of the
+   other family, can't carry the session and are not reported. */
+class AddressMonitor
+{
+private:
+  int fd;
+  int family; /* of the remote address */
+
+  AddressMonitor( const AddressMonitor& );
+  AddressMonitor& operator=( const AddressMonitor& );
+
+public:
+  enum Event
+  {
+    NONE,  /* nothing to read */
+    OTHER, /* notifications that don't matter */
+    CHANGE
+  };
+
+  AddressMonitor() : fd( -1 ), family( 0 ) {}
+  ~AddressMonitor();
+
+  /* Starts watching for changes that matter to a remote address of the
+     family.  Failing that, it stays idle. */
+  void start( int s_family );
+
+  /* -1 while idle */
+  int get_fd( void ) const { return fd; }
+
+  /* Reads every notification waiting. */
+  Event read( void );
+};
+}
+
+#endif
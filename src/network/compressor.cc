@@ -30,27 +30,416 @@
     also delete it here.
 */
 
+#include "src/include/config.h"
+
+#include <cstring>
+
 #include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
 
 #include "compressor.h"
+#include "src/network/network.h"
 #include "src/util/dos_assert.h"
+#include "src/util/fatal_assert.h"
 
 using namespace Network;
 
-std::string Compressor::compress_str( const std::string& input )
+/* Preset dictionary for CAPABILITY_DEFLATE_DICTIONARY, also used by
+   the zstd and lz4 codecs.  Small instructions are mostly the same few
+   escape sequences and protobuf framing, which a compressor cannot
+   exploit without earlier context.  Matches near the end of the
+   dictionary are cheapest, so the most common strings go last.
+   Changing this breaks compatibility: it must stay byte-for-byte
+   identical between peers, and is identified on the wire only by its
+   Adler-32 (zlib) or by the codec's tag.
+
+   It is written by hand, not trained.  The protobuf framing is field
+   tags and small values from transportinstruction.proto,
+   hostinput.proto and userinput.proto; the host output is what
+   Display::new_frame() and Display::open() emit; the keystrokes are
+   xterm's cursor, function and editing keys.  src/examples/compressbench
+   measures it against script(1) recordings. */
+static const char preset_dictionary[] =
+  /* HostBuffers::FrameUpdate framing (cell diffs) */
+  "\x10\x00\x18\x00\x0a\x06\x08\x01\x10\x00\x18\x00\x1a\x00\x0c\x00\x0e\x00\x0a\x00\x00\x99\x01\x02\x00\x09\x01"
+  /* keystrokes: cursor and editing keys */
+  "\x1bOA\x1bOB\x1bOC\x1bOD\x1b[A\x1b[B\x1b[C\x1b[D\x1b[H\x1b[F\x1b[2~\x1b[3~\x1b[5~\x1b[6~\x1bOP\x1bOQ\x1bOR\x1bOS"
+  "\x1b[200~\x1b[201~\x7f\x7f\x7f"
+  /* host output: modes and titles */
+  "\x1b[?1049h\x1b[?1049l\x1b[?1h\x1b=\x1b[?1l\x1b>\x1b[?2004h\x1b[?2004l\x1b[?1000h\x1b[?1002h\x1b[?1006h"
+  "\x1b]0;\x07\x1b]52;c;\x07"
+  /* host output: colors and renditions */
+  "\x1b[0;38;5;\x1b[0;48;5;\x1b[0;1;3\x1b[0;7m\x1b[0;1m\x1b[0;4m\x1b[0;3"
+  "1m\x1b[0;32m\x1b[0;33m\x1b[0;34m\x1b[0;35m\x1b[0;36m\x1b[0;37m\x1b[0;90m\x1b[0;4"
+  /* host output: erasing and cursor motion */
+  "\x1b[K\x1b[J\x1b[2J\x1b[H\x1b[1;1H\x1b[X\x1b[?25h\x1b[?25l"
+  "\x1b[r\x1b[1;24r\x1b[24;1H\x0a\x0a\x0a\x0a\x1b[r\x1b[1;1H\x1b[0m\x1b[K\r\n"
+  /* every Instruction: protocol version, a keystroke, then host bytes
+     behind the hyperlink and rendition reset that open each frame */
+  "\x08\x02\x10\x00\x18\x00 \x00(\x00" "2\x07\x0a\x05\x12\x03\"\x01x:\x00@\x03"
+  "\x08\x02\x10\x00\x18\x00 \x00(\x00" "2\x00\x0a\x00\x12\x00\"\x00\x1b[0m\x1b]8;;\x1b\\\x1b[?25l\x1b[0m\x1b[?25h";
+
+static const size_t preset_dictionary_len = sizeof( preset_dictionary ) - 1;
+
+/* Tags for formats other than zlib; the low nibble must never be 8. */
+static const unsigned char TAG_STORED = 0x00; /* the input itself follows */
+static const unsigned char TAG_ZSTD = 0x01;
+static const unsigned char TAG_LZ4 = 0x02;
+
+/* Small instructions dominate interactive use and are cheap to squeeze
+   hard; big screen repaints and pastes trade some ratio for speed. */
+static const size_t SMALL_INPUT = 4096;
+static const size_t LARGE_INPUT = 256 * 1024;
+
+namespace {
+class ZlibCodec : public Codec
+{
+private:
+  /* Streams are reset and reused rather than set up per instruction. */
+  z_stream deflater;
+  int deflater_level;
+  z_stream inflater;
+
+  size_t deflate_to( const std::string& input, bool dictionary, unsigned char* out, size_t out_len );
+
+  ZlibCodec( const ZlibCodec& );
+  ZlibCodec& operator=( const ZlibCodec& );
+
+public:
+  ZlibCodec();
+  ~ZlibCodec();
+
+  const char* name( void ) const { return "zlib"; }
+  uint32_t capability( void ) const { return 0; }
+  size_t compress( const std::string& input, uint32_t remote_capabilities, unsigned char* out, size_t out_len );
+  size_t uncompress( const unsigned char* in, size_t len, unsigned char* out, size_t out_len );
+};
+}
+
+static uLong preset_dictionary_id( void )
+{
+  static const uLong id = adler32(
+    adler32( 0, Z_NULL, 0 ), reinterpret_cast<const Bytef*>( preset_dictionary ), preset_dictionary_len );
+  return id;
+}
+
+ZlibCodec::ZlibCodec() : deflater(), deflater_level( Z_DEFAULT_COMPRESSION ), inflater()
+{
+  deflater.zalloc = Z_NULL;
+  deflater.zfree = Z_NULL;
+  deflater.opaque = Z_NULL;
+  fatal_assert( deflateInit( &deflater, deflater_level ) == Z_OK );
+
+  inflater.zalloc = Z_NULL;
+  inflater.zfree = Z_NULL;
+  inflater.opaque = Z_NULL;
+  inflater.next_in = Z_NULL;
+  inflater.avail_in = 0;
+  fatal_assert( inflateInit( &inflater ) == Z_OK );
+}
+
+ZlibCodec::~ZlibCodec()
+{
+  deflateEnd( &deflater );
+  inflateEnd( &inflater );
+}
+
+size_t ZlibCodec::compress( const std::string& input,
+                            uint32_t remote_capabilities,
+                            unsigned char* out,
+                            size_t out_len )
+{
+  const bool dictionary = remote_capabilities & CAPABILITY_DEFLATE_DICTIONARY;
+
+  /* The dictionary costs four bytes of header.  Small instructions are
+     cheap enough to try both ways and keep the shorter. */
+  if ( dictionary && ( input.size() < SMALL_INPUT ) ) {
+    const size_t without = deflate_to( input, false, out, out_len );
+    const size_t with = deflate_to( input, true, out + without, out_len - without );
+    if ( with < without ) {
+      memmove( out, out + without, with );
+      return with;
+    }
+    return without;
+  }
+  return deflate_to( input, dictionary, out, out_len );
+}
+
+size_t ZlibCodec::deflate_to( const std::string& input, bool dictionary, unsigned char* out, size_t out_len )
+{
+  fatal_assert( deflateReset( &deflater ) == Z_OK );
+
+  const int level = ( input.size() < SMALL_INPUT ) ? Z_BEST_COMPRESSION
+                    : ( input.size() < LARGE_INPUT ) ? Z_DEFAULT_COMPRESSION
+                                                     : 3;
+  if ( level != deflater_level ) {
+    fatal_assert( deflateParams( &deflater, level, Z_DEFAULT_STRATEGY ) == Z_OK );
+    deflater_level = level;
+  }
+
+  if ( dictionary ) {
+    fatal_assert(
+      deflateSetDictionary( &deflater, reinterpret_cast<const Bytef*>( preset_dictionary ), preset_dictionary_len )
+      == Z_OK );
+  }
+
+  deflater.next_in = reinterpret_cast<Bytef*>( const_cast<char*>( input.data() ) );
+  deflater.avail_in = input.size();
+  deflater.next_out = out;
+  deflater.avail_out = out_len;
+  dos_assert( Z_STREAM_END == deflate( &deflater, Z_FINISH ) );
+
+  return out_len - deflater.avail_out;
+}
+
+size_t ZlibCodec::uncompress( const unsigned char* in, size_t len, unsigned char* out, size_t out_len )
+{
+  fatal_assert( inflateReset( &inflater ) == Z_OK );
+
+  inflater.next_in = const_cast<Bytef*>( in );
+  inflater.avail_in = len;
+  inflater.next_out = out;
+  inflater.avail_out = out_len;
+
+  int ret = inflate( &inflater, Z_FINISH );
+  if ( ret == Z_NEED_DICT ) {
+    dos_assert( inflater.adler == preset_dictionary_id() );
+    fatal_assert(
+      inflateSetDictionary( &inflater, reinterpret_cast<const Bytef*>( preset_dictionary ), preset_dictionary_len )
+      == Z_OK );
+    ret = inflate( &inflater, Z_FINISH );
+  }
+  dos_assert( Z_STREAM_END == ret );
+
+  return out_len - inflater.avail_out;
+}
+
+#ifdef HAVE_ZSTD
+namespace {
+/* zstd with the preset dictionary as raw content, at a level chosen by size */
+class ZstdCodec : public Codec
+{
+private:
+  ZSTD_CCtx* cctx;
+  ZSTD_DCtx* dctx;
+  ZSTD_CDict* small_cdict;
+  ZSTD_CDict* medium_cdict;
+  ZSTD_CDict* large_cdict;
+  ZSTD_DDict* ddict;
+
+  ZstdCodec( const ZstdCodec& );
+  ZstdCodec& operator=( const ZstdCodec& );
+
+public:
+  ZstdCodec()
+    : cctx( ZSTD_createCCtx() ), dctx( ZSTD_createDCtx() ),
+      small_cdict( ZSTD_createCDict( preset_dictionary, preset_dictionary_len, 19 ) ),
+      medium_cdict( ZSTD_createCDict( preset_dictionary, preset_dictionary_len, 9 ) ),
+      large_cdict( ZSTD_createCDict( preset_dictionary, preset_dictionary_len, 3 ) ),
+      ddict( ZSTD_createDDict( preset_dictionary, preset_dictionary_len ) )
+  {
+    fatal_assert( cctx && dctx && small_cdict && medium_cdict && large_cdict && ddict );
+  }
+
+  ~ZstdCodec()
+  {
+    ZSTD_freeCCtx( cctx );
+    ZSTD_freeDCtx( dctx );
+    ZSTD_freeCDict( small_cdict );
+    ZSTD_freeCDict( medium_cdict );
+    ZSTD_freeCDict( large_cdict );
+    ZSTD_freeDDict( ddict );
+  }
+
+  const char* name( void ) const { return "zstd"; }
+  uint32_t capability( void ) const { return CAPABILITY_ZSTD; }
+
+  size_t compress( const std::string& input,
+                   uint32_t remote_capabilities __attribute( ( unused ) ),
+                   unsigned char* out,
+                   size_t out_len )
+  {
+    const ZSTD_CDict* cdict = ( input.size() < SMALL_INPUT )   ? small_cdict
+                              : ( input.size() < LARGE_INPUT ) ? medium_cdict
+                                                               : large_cdict;
+    out[0] = TAG_ZSTD;
+    const size_t len = ZSTD_compress_usingCDict( cctx, out + 1, out_len - 1, input.data(), input.size(), cdict );
+    dos_assert( !ZSTD_isError( len ) );
+    return 1 + len;
+  }
+
+  size_t uncompress( const unsigned char* in, size_t len, unsigned char* out, size_t out_len )
+  {
+    const size_t ret = ZSTD_decompress_usingDDict( dctx, out, out_len, in + 1, len - 1, ddict );
+    dos_assert( !ZSTD_isError( ret ) );
+    return ret;
+  }
+};
+}
+#endif
+
+#ifdef HAVE_LZ4
+namespace {
+/* lz4 block format with the preset dictionary, after the tag and the
+   uncompressed length (32 bits, network byte order) */
+class Lz4Codec : public Codec
+{
+private:
+  LZ4_stream_t* stream;
+
+  Lz4Codec( const Lz4Codec& );
+  Lz4Codec& operator=( const Lz4Codec& );
+
+public:
+  Lz4Codec() : stream( LZ4_createStream() ) { fatal_assert( stream ); }
+  ~Lz4Codec() { LZ4_freeStream( stream ); }
+
+  const char* name( void ) const { return "lz4"; }
+  uint32_t capability( void ) const { return CAPABILITY_LZ4; }
+
+  size_t compress( const std::string& input,
+                   uint32_t remote_capabilities __attribute( ( unused ) ),
+                   unsigned char* out,
+                   size_t out_len )
+  {
+    const size_t header_len = 1 + sizeof( uint32_t );
+    dos_assert( input.size() <= size_t( LZ4_MAX_INPUT_SIZE ) );
+    out[0] = TAG_LZ4;
+    for ( int i = 0; i < 4; i++ ) {
+      out[1 + i] = ( input.size() >> ( 24 - 8 * i ) ) & 0xff;
+    }
+
+    LZ4_loadDict( stream, preset_dictionary, preset_dictionary_len );
+    const int len = LZ4_compress_fast_continue( stream,
+                                                input.data(),
+                                                reinterpret_cast<char*>( out + header_len ),
+                                                input.size(),
+                                                out_len - header_len,
+                                                1 );
+    dos_assert( len > 0 );
+    return header_len + len;
+  }
+
+  size_t uncompress( const unsigned char* in, size_t len, unsigned char* out, size_t out_len )
+  {
+    const size_t header_len = 1 + sizeof( uint32_t );
+    dos_assert( len >= header_len );
+    size_t original_len = 0;
+    for ( int i = 0; i < 4; i++ ) {
+      original_len = ( original_len << 8 ) | in[1 + i];
+    }
+    dos_assert( original_len <= out_len );
+
+    const int ret = LZ4_decompress_safe_usingDict( reinterpret_cast<const char*>( in + header_len ),
+                                                   reinterpret_cast<char*>( out ),
+                                                   len - header_len,
+                                                   original_len,
+                                                   preset_dictionary,
+                                                   preset_dictionary_len );
+    dos_assert( ( ret >= 0 ) && ( size_t( ret ) == original_len ) );
+    return ret;
+  }
+};
+}
+#endif
+
+Compressor::Compressor()
+  : buffer(), zlib( new ZlibCodec ), zstd(), lz4(), preferred( zlib.get() ), counters()
 {
-  long unsigned int len = BUFFER_SIZE;
-  dos_assert( Z_OK
-              == compress( buffer, &len, reinterpret_cast<const unsigned char*>( input.data() ), input.size() ) );
+#ifdef HAVE_ZSTD
+  zstd.reset( new ZstdCodec );
+#endif
+#ifdef HAVE_LZ4
+  lz4.reset( new Lz4Codec );
+#endif
+}
+
+Compressor::~Compressor() {}
+
+bool Compressor::set_preference( const char* name )
+{
+  Codec* const codecs[] = { zlib.get(), zstd.get(), lz4.get() };
+  for ( size_t i = 0; i < sizeof( codecs ) / sizeof( codecs[0] ); i++ ) {
+    if ( codecs[i] && !strcmp( codecs[i]->name(), name ) ) {
+      preferred = codecs[i];
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t Compressor::capabilities( void ) const
+{
+  uint32_t ret = CAPABILITY_DEFLATE_DICTIONARY | CAPABILITY_STORED;
+  if ( zstd ) {
+    ret |= zstd->capability();
+  }
+  if ( lz4 ) {
+    ret |= lz4->capability();
+  }
+  return ret;
+}
+
+std::string Compressor::compress_str( const std::string& input, uint32_t remote_capabilities )
+{
+  const bool can_store = remote_capabilities & CAPABILITY_STORED;
+  counters.sent++;
+
+  /* Acks and keystrokes are mostly varints and random chaff, and grow
+     under every codec; don't spend time on either end finding that out. */
+  if ( can_store && ( input.size() < STORED_THRESHOLD ) ) {
+    counters.sent_stored_small++;
+    counters.sent_stored_small_bytes += input.size();
+    return std::string( 1, char( TAG_STORED ) ) + input;
+  }
+
+  Codec* codec = ( remote_capabilities & preferred->capability() ) ? preferred : zlib.get();
+  const size_t len = codec->compress( input, remote_capabilities, buffer, BUFFER_SIZE );
+
+  if ( can_store && ( len > input.size() ) ) {
+    counters.sent_stored_incompressible++;
+    counters.stored_bytes_saved += len - ( 1 + input.size() );
+    return std::string( 1, char( TAG_STORED ) ) + input;
+  }
   return std::string( reinterpret_cast<char*>( buffer ), len );
 }
 
 std::string Compressor::uncompress_str( const std::string& input )
 {
-  long unsigned int len = BUFFER_SIZE;
-  dos_assert( Z_OK
-              == uncompress( buffer, &len, reinterpret_cast<const unsigned char*>( input.data() ), input.size() ) );
-  return std::string( reinterpret_cast<char*>( buffer ), len );
+  size_t len;
+  const char* out = uncompress( input.data(), input.size(), &len );
+  return std::string( out, len );
+}
+
+const char* Compressor::uncompress( const char* input, size_t len, size_t* out_len )
+{
+  dos_assert( len > 0 );
+  const unsigned char* in = reinterpret_cast<const unsigned char*>( input );
+
+  counters.received++;
+  if ( in[0] == TAG_STORED ) {
+    counters.received_stored++;
+    *out_len = len - 1;
+    return input + 1;
+  }
+
+  Codec* codec = NULL;
+  if ( ( in[0] & 0x0f ) == 8 ) {
+    codec = zlib.get();
+  } else if ( in[0] == TAG_ZSTD ) {
+    codec = zstd.get();
+  } else if ( in[0] == TAG_LZ4 ) {
+    codec = lz4.get();
+  }
+  dos_assert( codec != NULL ); /* unknown, or not built in */
+
+  *out_len = codec->uncompress( in, len, buffer, BUFFER_SIZE );
+  return reinterpret_cast<char*>( buffer );
 }
 
 /* construct on first use */
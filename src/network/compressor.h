@@ -33,22 +33,88 @@
 #ifndef COMPRESSOR_H
 #define COMPRESSOR_H
 
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <string>
 
 namespace Network {
+/* A compression method.  Output from any codec but zlib starts with the
+   codec's tag byte.  A zlib stream starts with a CMF byte whose low
+   nibble is always 8 (deflate), and tags never have 8 there, so
+   payloads from peers that only know zlib stay unambiguous. */
+class Codec
+{
+public:
+  virtual ~Codec() {}
+
+  virtual const char* name( void ) const = 0;
+  /* the peer must advertise this before we send it our output (0 for zlib) */
+  virtual uint32_t capability( void ) const = 0;
+
+  /* Write the compressed form of input to out and return its length.
+     remote_capabilities may enable optional features the peer supports. */
+  virtual size_t compress( const std::string& input,
+                           uint32_t remote_capabilities,
+                           unsigned char* out,
+                           size_t out_len )
+    = 0;
+  /* Uncompress a payload in this codec's format and return its length;
+     a dos_assert() fails on bad input. */
+  virtual size_t uncompress( const unsigned char* in, size_t len, unsigned char* out, size_t out_len ) = 0;
+};
+
+/* Payloads shorter than this are sent stored if the peer allows it */
+static const size_t STORED_THRESHOLD = 64;
+
 class Compressor
 {
+public:
+  /* for --verbose */
+  struct Counters
+  {
+    uint64_t sent;
+    uint64_t sent_stored_small;          /* not given to a codec at all */
+    uint64_t sent_stored_small_bytes;    /* ... and their total length */
+    uint64_t sent_stored_incompressible; /* compressed, but that made them longer */
+    uint64_t stored_bytes_saved;         /* ... by how much */
+    uint64_t received;
+    uint64_t received_stored; /* not given to a codec at all */
+  };
+
 private:
   static const int BUFFER_SIZE = 2048 * 2048; /* effective limit on terminal size */
 
   unsigned char buffer[BUFFER_SIZE];
 
+  std::unique_ptr<Codec> zlib;
+  std::unique_ptr<Codec> zstd; /* NULL unless built with libzstd */
+  std::unique_ptr<Codec> lz4;  /* NULL unless built with liblz4 */
+  Codec* preferred;
+  Counters counters;
+
 public:
-  Compressor() : buffer() {}
-  ~Compressor() {}
+  Compressor();
+  ~Compressor();
 
-  std::string compress_str( const std::string& input );
+  /* Uses the preferred codec if the peer advertised it, and zlib otherwise.
+     If the peer advertised CAPABILITY_STORED, small payloads and those
+     that would grow are sent as they are, behind a tag byte.
+     uncompress_str() takes the output of any codec built in. */
+  std::string compress_str( const std::string& input, uint32_t remote_capabilities = 0 );
   std::string uncompress_str( const std::string& input );
+  /* The same, into a buffer owned by the Compressor (or input itself,
+     if stored) that is valid until the Compressor is next used. */
+  const char* uncompress( const char* input, size_t len, size_t* out_len );
+
+  /* "zlib", "zstd" or "lz4"; false if unknown or not built in */
+  bool set_preference( const char* name );
+  const char* get_preference( void ) const { return preferred->name(); }
+
+  /* CAPABILITY_* bits for the formats we can uncompress */
+  uint32_t capabilities( void ) const;
+
+  const Counters& get_counters( void ) const { return counters; }
 
   /* unused */
   Compressor( const Compressor& );
@@ -0,0 +1,132 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include <algorithm>
+
+#include "delaycontroller.h"
+
+using namespace Network;
+
+void DelayController::rtt_sample( double RTT, uint64_t now )
+{
+  if ( base_delays.empty() || ( now - base_delay_start >= BASE_DELAY_INTERVAL ) ) {
+    base_delays.push_back( RTT );
+    base_delay_start = now;
+    if ( base_delays.size() > BASE_DELAY_HISTORY ) {
+      base_delays.pop_front();
+    }
+  } else {
+    base_delays.back() = std::min( base_delays.back(), RTT );
+  }
+
+  current_delays.push_back( RTT );
+  if ( current_delays.size() > CURRENT_DELAY_FILTER ) {
+    current_delays.pop_front();
+  }
+}
+
+double DelayController::base_delay( void ) const
+{
+  return base_delays.empty() ? 0 : *std::min_element( base_delays.begin(), base_delays.end() );
+}
+
+double DelayController::queueing_delay( void ) const
+{
+  if ( current_delays.empty() ) {
+    return 0;
+  }
+  return *std::min_element( current_delays.begin(), current_delays.end() ) - base_delay();
+}
+
+void DelayController::ack( size_t bytes, size_t flight )
+{
+  if ( !measured() ) {
+    return;
+  }
+
+  /* at worst, halve the window over one window of acks */
+  const double off_target = std::max( -1.0, ( DELAY_TARGET - queueing_delay() ) / DELAY_TARGET );
+  window += DELAY_GAIN * off_target * bytes * DELAY_DATAGRAM / window;
+
+  /* don't grow a window an interactive session isn't using */
+  window = std::min( window,
+                     double( std::max( DELAY_INITIAL_WINDOW, flight + DELAY_ALLOWED_INCREASE * DELAY_DATAGRAM ) ) );
+  window = std::max( double( DELAY_MIN_WINDOW ), std::min( double( DELAY_MAX_WINDOW ), window ) );
+}
+
+void DelayController::loss( uint64_t now, double SRTT )
+{
+  if ( now - last_decrease < SRTT ) {
+    return;
+  }
+  last_decrease = now;
+  window = std::max( double( DELAY_MIN_WINDOW ), window / 2 );
+}
+
+void DelayController::ecn_counts( uint64_t ect, uint64_t ce, uint64_t now, double SRTT )
+{
+  /* Below the counts of an RTT ago: no report is that late, so the
+     peer restarted its counts.  Measure from the new ones. */
+  if ( ( ect < ecn_ect ) || ( ce < ecn_ce ) ) {
+    ecn_ect = ecn_last_ect = ect;
+    ecn_ce = ecn_last_ce = ce;
+    ecn_start = now;
+    return;
+  }
+  if ( ( ect < ecn_last_ect ) || ( ce < ecn_last_ce ) ) {
+    return; /* reordered behind a later report */
+  }
+  ecn_last_ect = ect;
+  ecn_last_ce = ce;
+
+  if ( now - ecn_start < SRTT ) {
+    return;
+  }
+
+  const uint64_t marked = ce - ecn_ce;
+  const uint64_t total = marked + ( ect - ecn_ect );
+  if ( total > 0 ) {
+    ecn_alpha += ECN_GAIN * ( double( marked ) / total - ecn_alpha );
+    if ( marked > 0 ) {
+      window = std::max( double( DELAY_MIN_WINDOW ), window * ( 1 - ecn_alpha / 2 ) );
+    }
+  }
+
+  ecn_ect = ect;
+  ecn_ce = ce;
+  ecn_start = now;
+}
+
+double DelayController::pacing_rate( double SRTT ) const
+{
+  return PACING_GAIN * window / std::max( SRTT, 1.0 );
+}
@@ -0,0 +1,106 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#ifndef DELAY_CONTROLLER_HPP
+#define DELAY_CONTROLLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace Network {
+/* congestion control parameters */
+const double DELAY_TARGET = 25;                   /* ms of queueing delay to aim for */
+const double DELAY_GAIN = 1;                      /* window growth per window of acked bytes, at zero delay */
+const size_t DELAY_DATAGRAM = 1280;               /* nominal datagram size, bytes */
+const size_t DELAY_INITIAL_WINDOW = 10 * 1280;    /* bytes per RTT, and the least growth is capped to */
+const size_t DELAY_MIN_WINDOW = 2 * 1280;         /* bytes per RTT */
+const size_t DELAY_MAX_WINDOW = 64 * 1024 * 1024; /* bytes per RTT */
+const size_t DELAY_ALLOWED_INCREASE = 2;          /* datagrams the window may exceed the bytes in flight by */
+const double PACING_GAIN = 2;                     /* a window goes out in half an RTT */
+const size_t PACING_BURST = 2;                    /* datagrams that may go back to back */
+const uint64_t BASE_DELAY_INTERVAL = 60000;       /* ms covered by each base delay minimum */
+const size_t BASE_DELAY_HISTORY = 10;             /* ... and how many of them to keep */
+const size_t CURRENT_DELAY_FILTER = 4;            /* RTT samples the current delay is the minimum of */
+const double ECN_GAIN = 1.0 / 16;                 /* weight of each RTT's marked fraction */
+
+/* LEDBAT-style (RFC 6817) congestion control.  We only measure round
+   trips, so queueing delay is the current RTT (the minimum of the last
+   few samples, to ignore jitter) less the base RTT (the minimum over
+   the last several minutes).  The window grows while queueing delay is
+   under DELAY_TARGET and shrinks as it exceeds it, so a mosh session
+   stops filling a bloated buffer before its own keystrokes suffer.  A
+   lost instruction halves the window, at most once per RTT.
+
+   ECN marks get a DCTCP-style (RFC 8257) response instead: once per
+   RTT the fraction of our datagrams the peer saw marked CE updates a
+   moving average, alpha, and if any were marked the window shrinks by
+   alpha/2.  Light, early marking from an L4S queue thus slows us down
+   a little at a time rather than halving. */
+class DelayController
+{
+private:
+  double window; /* bytes per RTT */
+  std::deque<double> base_delays;
+  uint64_t base_delay_start; /* when the newest base delay interval began */
+  std::deque<double> current_delays;
+  uint64_t last_decrease;
+
+  double ecn_alpha;
+  uint64_t ecn_ect, ecn_ce;           /* peer's counts at the start of this RTT */
+  uint64_t ecn_start;                 /* ... and when it began */
+  uint64_t ecn_last_ect, ecn_last_ce; /* peer's latest counts */
+
+public:
+  DelayController()
+    : window( DELAY_INITIAL_WINDOW ), base_delays(), base_delay_start( 0 ), current_delays(), last_decrease( 0 ),
+      ecn_alpha( 0 ), ecn_ect( 0 ), ecn_ce( 0 ), ecn_start( 0 ), ecn_last_ect( 0 ), ecn_last_ce( 0 )
+  {}
+
+  void rtt_sample( double RTT, uint64_t now );
+  /* bytes newly acknowledged, with flight the bytes that were unacknowledged */
+  void ack( size_t bytes, size_t flight );
+  void loss( uint64_t now, double SRTT );
+  /* the peer's running counts of our datagrams it received ECT and CE */
+  void ecn_counts( uint64_t ect, uint64_t ce, uint64_t now, double SRTT );
+
+  bool measured( void ) const { return !current_delays.empty(); }
+  double get_window( void ) const { return window; }
+  double get_ecn_alpha( void ) const { return ecn_alpha; }
+  double base_delay( void ) const;
+  double queueing_delay( void ) const;
+  /* bytes per ms to pace datagrams at */
+  double pacing_rate( double SRTT ) const;
+};
+}
+
+#endif
@@ -32,6 +32,7 @@
 
 #include "src/include/config.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cstring>
@@ -43,6 +44,12 @@
 #endif
 #include <netdb.h>
 #include <netinet/in.h>
+#ifdef HAVE_GETIFADDRS
+#include <ifaddrs.h>
+#endif
+#if defined( HAVE_UDP_SEGMENT ) || defined( HAVE_UDP_GRO )
+#include <netinet/udp.h>
+#endif
 #include <unistd.h>
 
 #include "src/crypto/byteorder.h"
@@ -73,26 +80,40 @@ Packet::Packet( const Message& message )
     direction( ( message.nonce.val() & DIRECTION_MASK ) ? TO_CLIENT : TO_SERVER ), timestamp( -1 ),
     timestamp_reply( -1 ), payload()
 {
-  dos_assert( message.text.size() >= 2 * sizeof( uint16_t ) );
+  dos_assert( message.text.size() >= HEADER_LEN );
 
-  const uint16_t* data = (uint16_t*)message.text.data();
-  timestamp = be16toh( data[0] );
-  timestamp_reply = be16toh( data[1] );
+  read_header( message.text.data(), &timestamp, &timestamp_reply );
 
-  payload = std::string( message.text.begin() + 2 * sizeof( uint16_t ), message.text.end() );
+  payload = std::string( message.text.begin() + HEADER_LEN, message.text.end() );
+}
+
+void Packet::read_header( const char* buf, uint16_t* timestamp, uint16_t* timestamp_reply )
+{
+  uint16_t ts_net[2];
+  memcpy( ts_net, buf, HEADER_LEN );
+  *timestamp = be16toh( ts_net[0] );
+  *timestamp_reply = be16toh( ts_net[1] );
 }
 
 /* Output from packet */
 Message Packet::toMessage( void )
 {
-  uint64_t direction_seq = ( uint64_t( direction == TO_CLIENT ) << 63 ) | ( seq & SEQUENCE_MASK );
+  char header[HEADER_LEN];
+  write_header( header );
 
-  uint16_t ts_net[2]
-    = { static_cast<uint16_t>( htobe16( timestamp ) ), static_cast<uint16_t>( htobe16( timestamp_reply ) ) };
+  return Message( nonce(), std::string( header, HEADER_LEN ) + payload );
+}
 
-  std::string timestamps = std::string( (char*)ts_net, 2 * sizeof( uint16_t ) );
+Nonce Packet::nonce( void ) const
+{
+  return Nonce( ( uint64_t( direction == TO_CLIENT ) << 63 ) | ( seq & SEQUENCE_MASK ) );
+}
 
-  return Message( Nonce( direction_seq ), timestamps + payload );
+void Packet::write_header( char* buf ) const
+{
+  uint16_t ts_net[2]
+    = { static_cast<uint16_t>( htobe16( timestamp ) ), static_cast<uint16_t>( htobe16( timestamp_reply ) ) };
+  memcpy( buf, ts_net, HEADER_LEN );
 }
 
 Packet Connection::new_packet( const std::string& s_payload )
@@ -120,10 +141,100 @@ void Connection::hop_port( void )
   setup();
   assert( remote_addr_len != 0 );
   socks.push_back( Socket( remote_addr.sa.sa_family ) );
+  socks.back().set_ecn( ecn_feedback ? ECN_ECT1 : ECN_ECT0 );
 
   prune_sockets();
 }
 
+/* The address the system would send to the server from now, found by
+   connecting a socket that sends nothing, or empty if there is no route. */
+std::string Connection::source_address( void ) const
+{
+  std::string key;
+  const int fd = socket( remote_addr.sa.sa_family, SOCK_DGRAM, 0 );
+  if ( fd < 0 ) {
+    return key;
+  }
+
+  Addr local;
+  socklen_t local_len = sizeof( local );
+  if ( ( connect( fd, &remote_addr.sa, remote_addr_len ) == 0 )
+       && ( getsockname( fd, &local.sa, &local_len ) == 0 ) ) {
+    switch ( local.sa.sa_family ) {
+      case AF_INET:
+        key.assign( reinterpret_cast<const char*>( &local.sin.sin_addr ), sizeof local.sin.sin_addr );
+        break;
+      case AF_INET6:
+        key.assign( reinterpret_cast<const char*>( &local.sin6.sin6_addr ), sizeof local.sin6.sin6_addr );
+        break;
+      default:
+        break;
+    }
+  }
+  close( fd );
+  return key;
+}
+
+/* After address or route notifications, a client hops to a new port
+   only if it would now reach the server from another address, and not
+   again within ADDRESS_HOP_INTERVAL; a change in the meantime is looked
+   up once the interval has passed. */
+void Connection::check_local_source( uint64_t now )
+{
+  if ( !local_source_stale || ( now - last_address_hop < ADDRESS_HOP_INTERVAL ) ) {
+    return;
+  }
+  local_source_stale = false;
+
+  const std::string source = source_address();
+  if ( source == local_source ) {
+    return;
+  }
+  local_source = source;
+  if ( source.empty() ) { /* nowhere to go until a route comes back */
+    return;
+  }
+
+  last_address_hop = now;
+  hop_port();
+  local_address_changed = true;
+}
+
+/* A bound path the server has not answered on for a while may have lost
+   its mapping in a NAT, so it gets a fresh port as the primary would. */
+void Connection::rebind_quiet_paths( uint64_t now )
+{
+  for ( std::vector<BoundPath>::iterator it = bound_paths.begin(); it != bound_paths.end(); it++ ) {
+    if ( ( now - it->bound_at <= PORT_HOP_INTERVAL ) || ( now - it->stats.last_heard <= PORT_HOP_INTERVAL ) ) {
+      continue;
+    }
+    try {
+      BoundPath fresh( it->name, it->local, it->local_len );
+      fresh.socket.set_ecn( ecn_feedback ? ECN_ECT1 : ECN_ECT0 );
+      fresh.stats = it->stats;
+      *it = fresh;
+    } catch ( const NetworkException& e ) {
+      it->bound_at = now; /* the address may be gone for now; keep the old socket */
+    }
+  }
+}
+
+/* A path carries a share of bulk while the server is still answering on it. */
+bool Connection::path_usable( int n, uint64_t now )
+{
+  const PathStats& stats = path_stats( n );
+  return ( stats.received > 0 ) && ( now - stats.last_heard < PATH_QUIET_INTERVAL ) && ( stats.loss < 0.5 );
+}
+
+Connection::BoundPath::BoundPath( const std::string& s_name, const Addr& s_local, socklen_t s_local_len )
+  : name( s_name ), local( s_local ), local_len( s_local_len ), socket( s_local.sa.sa_family ),
+    bound_at( timestamp() ), stats()
+{
+  if ( ::bind( socket.fd(), &local.sa, local_len ) < 0 ) {
+    throw NetworkException( "bind", errno );
+  }
+}
+
 void Connection::prune_sockets( void )
 {
   /* don't keep old sockets if the new socket has been working for long enough */
@@ -147,25 +258,23 @@ void Connection::prune_sockets( void )
   }
 }
 
-Connection::Socket::Socket( int family ) : _fd( socket( family, SOCK_DGRAM, 0 ) )
+Connection::Socket::Socket( int family )
+  : _fd( socket( family, SOCK_DGRAM, 0 ) ), _family( family ), _gso( false ), _gro( false ), _df( false )
 {
   if ( _fd < 0 ) {
     throw NetworkException( "socket", errno );
   }
 
-  /* Disable path MTU discovery */
+  /* Disable path MTU discovery by ICMP; we probe for it ourselves */
 #ifdef HAVE_IP_MTU_DISCOVER
   int flag = IP_PMTUDISC_DONT;
   if ( setsockopt( _fd, IPPROTO_IP, IP_MTU_DISCOVER, &flag, sizeof flag ) < 0 ) {
     throw NetworkException( "setsockopt", errno );
   }
 #endif
+  _df = set_dont_fragment( false );
 
-  //  int dscp = 0x92; /* OS X does not have IPTOS_DSCP_AF42 constant */
-  int dscp = 0x02; /* ECN-capable transport only */
-  if ( setsockopt( _fd, IPPROTO_IP, IP_TOS, &dscp, sizeof dscp ) < 0 ) {
-    //    perror( "setsockopt( IP_TOS )" );
-  }
+  set_ecn( ECN_ECT0 );
 
   /* request explicit congestion notification on received datagrams */
 #ifdef HAVE_IP_RECVTOS
@@ -175,6 +284,81 @@ Connection::Socket::Socket( int family ) : _fd( socket( family, SOCK_DGRAM, 0 )
     perror( "setsockopt( IP_RECVTOS )" );
   }
 #endif
+#ifdef IPV6_RECVTCLASS
+  if ( family == AF_INET6 ) {
+    int tclassflag = true;
+    if ( setsockopt( _fd, IPPROTO_IPV6, IPV6_RECVTCLASS, &tclassflag, sizeof tclassflag ) < 0 ) {
+      perror( "setsockopt( IPV6_RECVTCLASS )" );
+    }
+  }
+#endif
+
+  /* use segmentation offload where the kernel has it */
+#ifdef HAVE_UDP_SEGMENT
+  int gso_size;
+  socklen_t gso_size_len = sizeof gso_size;
+  _gso = ( getsockopt( _fd, SOL_UDP, UDP_SEGMENT, &gso_size, &gso_size_len ) == 0 );
+#endif
+#ifdef HAVE_UDP_GRO
+  int groflag = true;
+  _gro = ( setsockopt( _fd, SOL_UDP, UDP_GRO, &groflag, sizeof groflag ) == 0 );
+#endif
+}
+
+void Connection::Socket::set_ecn( int codepoint ) const
+{
+  //  int dscp = 0x92; /* OS X does not have IPTOS_DSCP_AF42 constant */
+  int dscp = codepoint; /* ECN-capable transport only */
+  if ( setsockopt( _fd, IPPROTO_IP, IP_TOS, &dscp, sizeof dscp ) < 0 ) {
+    //    perror( "setsockopt( IP_TOS )" );
+  }
+#ifdef IPV6_TCLASS
+  if ( _family == AF_INET6 ) {
+    /* also covers IPv4-mapped addresses on some systems, not all */
+    setsockopt( _fd, IPPROTO_IPV6, IPV6_TCLASS, &dscp, sizeof dscp );
+  }
+#endif
+}
+
+/* Path MTU probes must not be fragmented, but everything else may be,
+   as it always was.  Returns false if the system can't set the bit. */
+bool Connection::Socket::set_dont_fragment( bool df ) const
+{
+  bool ok = false;
+#if defined( HAVE_IP_MTU_DISCOVER ) && defined( IP_PMTUDISC_PROBE )
+  /* PROBE sets the bit but ignores what ICMP said of the path */
+  int flag = df ? IP_PMTUDISC_PROBE : IP_PMTUDISC_DONT;
+  ok = ( setsockopt( _fd, IPPROTO_IP, IP_MTU_DISCOVER, &flag, sizeof flag ) == 0 );
+#elif defined( IP_DONTFRAG )
+  int flag = df;
+  ok = ( setsockopt( _fd, IPPROTO_IP, IP_DONTFRAG, &flag, sizeof flag ) == 0 );
+#endif
+  if ( _family == AF_INET6 ) { /* the IPv4 option, if any, covers IPv4-mapped addresses */
+#if defined( IPV6_MTU_DISCOVER ) && defined( IPV6_PMTUDISC_PROBE )
+    int flag6 = df ? IPV6_PMTUDISC_PROBE : IPV6_PMTUDISC_WANT;
+    ok = ( setsockopt( _fd, IPPROTO_IPV6, IPV6_MTU_DISCOVER, &flag6, sizeof flag6 ) == 0 );
+#elif defined( IPV6_DONTFRAG )
+    int flag6 = df;
+    ok = ( setsockopt( _fd, IPPROTO_IPV6, IPV6_DONTFRAG, &flag6, sizeof flag6 ) == 0 );
+#else
+    ok = false;
+#endif
+  }
+  return ok;
+}
+
+void Connection::set_ecn_feedback( bool s_ecn_feedback )
+{
+  if ( ecn_feedback == s_ecn_feedback ) {
+    return;
+  }
+  ecn_feedback = s_ecn_feedback;
+  for ( std::deque<Socket>::const_iterator it = socks.begin(); it != socks.end(); it++ ) {
+    it->set_ecn( ecn_feedback ? ECN_ECT1 : ECN_ECT0 );
+  }
+  for ( std::vector<BoundPath>::const_iterator it = bound_paths.begin(); it != bound_paths.end(); it++ ) {
+    it->socket.set_ecn( ecn_feedback ? ECN_ECT1 : ECN_ECT0 );
+  }
 }
 
 void Connection::setup( void )
@@ -189,6 +373,12 @@ const std::vector<int> Connection::fds( void ) const
   for ( std::deque<Socket>::const_iterator it = socks.begin(); it != socks.end(); it++ ) {
     ret.push_back( it->fd() );
   }
+  for ( std::vector<BoundPath>::const_iterator it = bound_paths.begin(); it != bound_paths.end(); it++ ) {
+    ret.push_back( it->socket.fd() );
+  }
+  if ( address_monitor.get_fd() >= 0 ) {
+    ret.push_back( address_monitor.get_fd() );
+  }
 
   return ret;
 }
@@ -207,6 +397,80 @@ void Connection::set_MTU( int family )
   }
 }
 
+/* Looks up, or starts, the path MTU search for remote_addr. */
+void Connection::set_path( void )
+{
+  std::string key;
+  int header_len;
+  switch ( remote_addr.sa.sa_family ) {
+    case AF_INET:
+      key.assign( reinterpret_cast<const char*>( &remote_addr.sin.sin_addr ), sizeof remote_addr.sin.sin_addr );
+      header_len = IPV4_HEADER_LEN;
+      break;
+    case AF_INET6:
+      key.assign( reinterpret_cast<const char*>( &remote_addr.sin6.sin6_addr ), sizeof remote_addr.sin6.sin6_addr );
+      header_len = IPV6_HEADER_LEN;
+      break;
+    default:
+      path = NULL;
+      return;
+  }
+
+  path_map_type::iterator it = paths.find( key );
+  if ( it == paths.end() ) {
+    if ( paths.size() >= MAX_PATHS ) {
+      paths.erase( paths.begin() );
+    }
+    PathMTU fresh( DEFAULT_SEND_MTU, MTU, MAX_PROBE_MTU - header_len );
+    it = paths.insert( path_map_type::value_type( key, fresh ) ).first;
+  }
+  path = &it->second;
+}
+
+int Connection::get_MTU_probe( void ) const
+{
+  /* in multipath mode bulk goes out on other paths than the probes */
+  if ( ( path == NULL ) || socks.empty() || !socks.back().can_probe() || !bound_paths.empty() ) {
+    return 0;
+  }
+  return path->probe_size( timestamp() );
+}
+
+bool Connection::send_MTU_probe( const struct iovec* iov, int iovcnt, int size )
+{
+  const Socket& s = socks.back();
+  if ( !s.set_dont_fragment( true ) ) {
+    return false;
+  }
+  probing = size;
+  send( iov, iovcnt );
+  const bool sent = ( probing != 0 ); /* record_send_error() clears it */
+  probing = 0;
+  s.set_dont_fragment( false );
+  return sent;
+}
+
+void Connection::MTU_probe_acked( int size )
+{
+  if ( path ) {
+    path->probe_acked( size, timestamp() );
+  }
+}
+
+void Connection::MTU_probe_lost( int size )
+{
+  if ( path ) {
+    path->probe_lost( size, timestamp() );
+  }
+}
+
+void Connection::MTU_black_hole( void )
+{
+  if ( path ) {
+    path->black_hole( timestamp() );
+  }
+}
+
 class AddrInfo
 {
 public:
@@ -228,10 +492,16 @@ private:
 };
 
 Connection::Connection( const char* desired_ip, const char* desired_port ) /* server */
-  : socks(), has_remote_addr( false ), remote_addr(), remote_addr_len( 0 ), server( true ), MTU( DEFAULT_SEND_MTU ),
-    key(), session( key ), direction( TO_CLIENT ), saved_timestamp( -1 ), saved_timestamp_received_at( 0 ),
-    expected_receiver_seq( 0 ), last_heard( -1 ), last_port_choice( -1 ), last_roundtrip_success( -1 ),
-    RTT_hit( false ), SRTT( 1000 ), RTTVAR( 500 ), send_error()
+  : socks(), bound_paths(), primary_stats(), last_path( 0 ), next_share( 0 ), has_remote_addr( false ),
+    remote_addr(), remote_addr_len( 0 ), previous_remote_addr(), previous_remote_addr_len( 0 ), server( true ),
+    MTU( DEFAULT_SEND_MTU ), paths(), path( NULL ), probing( 0 ), key(), session( key ), direction( TO_CLIENT ),
+    saved_timestamp( -1 ), saved_timestamp_received_at( 0 ), expected_receiver_seq( 0 ), received_seqs( 0 ),
+    last_heard( -1 ), last_port_choice( -1 ), address_monitor(), local_source(),
+    local_source_stale( false ), last_address_hop( 0 ), local_address_changed( false ),
+    last_roundtrip_success( -1 ), RTT_hit( false ), SRTT( 1000 ), RTTVAR( 500 ), last_RTT( 0 ), RTT_samples( 0 ),
+    ecn_feedback( false ), ecn_ect_received( 0 ), ecn_ce_received( 0 ), send_error(), recv_queue(),
+    recv_payloads( RECV_BATCH_MAX * Session::RECEIVE_MTU ), recv_next( 0 ), recv_count( 0 ),
+    send_ciphertexts( SEND_BATCH_MAX * Session::RECEIVE_MTU ), gro_buffer( GRO_BUFFER_LEN ), gro_pending()
 {
   setup();
 
@@ -339,10 +609,16 @@ bool Connection::try_bind( const char* addr, int port_low, int port_high )
 }
 
 Connection::Connection( const char* key_str, const char* ip, const char* port ) /* client */
-  : socks(), has_remote_addr( false ), remote_addr(), remote_addr_len( 0 ), server( false ),
-    MTU( DEFAULT_SEND_MTU ), key( key_str ), session( key ), direction( TO_SERVER ), saved_timestamp( -1 ),
-    saved_timestamp_received_at( 0 ), expected_receiver_seq( 0 ), last_heard( -1 ), last_port_choice( -1 ),
-    last_roundtrip_success( -1 ), RTT_hit( false ), SRTT( 1000 ), RTTVAR( 500 ), send_error()
+  : socks(), bound_paths(), primary_stats(), last_path( 0 ), next_share( 0 ), has_remote_addr( false ),
+    remote_addr(), remote_addr_len( 0 ), previous_remote_addr(), previous_remote_addr_len( 0 ), server( false ),
+    MTU( DEFAULT_SEND_MTU ), paths(), path( NULL ), probing( 0 ), key( key_str ), session( key ),
+    direction( TO_SERVER ), saved_timestamp( -1 ), saved_timestamp_received_at( 0 ), expected_receiver_seq( 0 ),
+    received_seqs( 0 ), last_heard( -1 ), last_port_choice( -1 ), address_monitor(), local_source(),
+    local_source_stale( false ), last_address_hop( 0 ), local_address_changed( false ),
+    last_roundtrip_success( -1 ), RTT_hit( false ), SRTT( 1000 ), RTTVAR( 500 ), last_RTT( 0 ), RTT_samples( 0 ),
+    ecn_feedback( false ), ecn_ect_received( 0 ), ecn_ce_received( 0 ), send_error(), recv_queue(),
+    recv_payloads( RECV_BATCH_MAX * Session::RECEIVE_MTU ), recv_next( 0 ), recv_count( 0 ),
+    send_ciphertexts( SEND_BATCH_MAX * Session::RECEIVE_MTU ), gro_buffer( GRO_BUFFER_LEN ), gro_pending()
 {
   setup();
 
@@ -362,31 +638,207 @@ Connection::Connection( const char* key_str, const char* ip, const char* port )
   socks.push_back( Socket( remote_addr.sa.sa_family ) );
 
   set_MTU( remote_addr.sa.sa_family );
+  set_path();
+
+  address_monitor.start( remote_addr.sa.sa_family );
+  local_source = source_address();
+}
+
+/* Finds an address of the given family on a network interface, preferring
+   one that is not link-local, which could not reach a server beyond it. */
+static bool interface_address( const std::string& name, int family, Addr* addr, socklen_t* addr_len )
+{
+  bool found = false;
+#ifdef HAVE_GETIFADDRS
+  struct ifaddrs* ifas;
+  if ( getifaddrs( &ifas ) < 0 ) {
+    throw NetworkException( "getifaddrs", errno );
+  }
+  for ( struct ifaddrs* ifa = ifas; ifa; ifa = ifa->ifa_next ) {
+    if ( ( ifa->ifa_addr == NULL ) || ( ifa->ifa_addr->sa_family != family ) || ( name != ifa->ifa_name ) ) {
+      continue;
+    }
+    const bool link_local
+      = ( family == AF_INET6 )
+        && IN6_IS_ADDR_LINKLOCAL( &reinterpret_cast<struct sockaddr_in6*>( ifa->ifa_addr )->sin6_addr );
+    if ( found && link_local ) {
+      continue;
+    }
+    *addr_len = ( family == AF_INET6 ) ? sizeof( struct sockaddr_in6 ) : sizeof( struct sockaddr_in );
+    memcpy( &addr->sa, ifa->ifa_addr, *addr_len );
+    found = true;
+    if ( !link_local ) {
+      break;
+    }
+  }
+  freeifaddrs( ifas );
+#endif
+  return found;
+}
+
+void Connection::add_path( const std::string& local )
+{
+  assert( !server );
+
+  if ( bound_paths.size() >= MAX_PATHS_BOUND ) {
+    throw NetworkException( "Too many paths (" + local + ")", 0 );
+  }
+
+  /* an interface's name, or one of this host's addresses */
+  Addr local_addr;
+  socklen_t local_addr_len;
+  if ( !interface_address( local, remote_addr.sa.sa_family, &local_addr, &local_addr_len ) ) {
+    struct addrinfo hints;
+    memset( &hints, 0, sizeof( hints ) );
+    hints.ai_family = remote_addr.sa.sa_family;
+    hints.ai_socktype = SOCK_DGRAM;
+    hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST | AI_NUMERICSERV;
+    AddrInfo ai( local.c_str(), "0", &hints );
+    local_addr_len = ai.res->ai_addrlen;
+    memcpy( &local_addr.sa, ai.res->ai_addr, local_addr_len );
+  }
+  switch ( local_addr.sa.sa_family ) {
+    case AF_INET:
+      local_addr.sin.sin_port = 0;
+      break;
+    case AF_INET6:
+      local_addr.sin6.sin6_port = 0;
+      break;
+  }
+
+  bound_paths.push_back( BoundPath( local, local_addr, local_addr_len ) );
+  bound_paths.back().socket.set_ecn( ecn_feedback ? ECN_ECT1 : ECN_ECT0 );
 }
 
 void Connection::send( const std::string& s )
 {
-  if ( !has_remote_addr ) {
+  struct iovec iov;
+  iov.iov_base = const_cast<char*>( s.data() );
+  iov.iov_len = s.size();
+  send( &iov, 1 );
+}
+
+void Connection::send( const struct iovec* iov, int iovcnt )
+{
+  Datagram d;
+  d.iov = iov;
+  d.iovcnt = iovcnt;
+  d.urgent = false;
+  send( &d, 1 );
+}
+
+void Connection::record_send_error( const char* call )
+{
+  if ( probing && ( errno == EMSGSIZE ) ) { /* larger than the interface allows */
+    path->probe_too_big( probing, timestamp() );
+    probing = 0;
     return;
   }
 
-  Packet px = new_packet( s );
+  /* Make sendmsg() failure available to the frontend. */
+  send_error = std::string( call ) + ": " + strerror( errno );
 
-  std::string p = session.encrypt( px.toMessage() );
+  if ( errno == EMSGSIZE ) {
+    MTU = DEFAULT_SEND_MTU; /* payload MTU of last resort */
+    if ( path ) {
+      path->refused( timestamp() );
+    }
+  }
+}
+
+/* A message failed.  If it carried a run of datagrams for segmentation
+   offload, which some paths refuse, stop using offload and send them one
+   by one; otherwise it is lost, as any datagram may be.  Only the primary
+   socket's errors are reported; a bound path that fails just goes quiet. */
+void Connection::send_failed( Socket& s, const struct msghdr& msg, int segments, const char* call )
+{
+  const bool primary = ( &s == &socks.back() );
+  if ( ( segments > 1 )
+       && ( ( errno == EIO ) || ( errno == EINVAL ) || ( errno == ENOPROTOOPT ) || ( errno == EOPNOTSUPP ) ) ) {
+    s.disable_gso();
+    for ( int i = 0; i < segments; i++ ) {
+      struct msghdr one = msg;
+      one.msg_iov = msg.msg_iov + 2 * i;
+      one.msg_iovlen = 2;
+      one.msg_control = NULL;
+      one.msg_controllen = 0;
+      if ( ( sendmsg( s.fd(), &one, MSG_DONTWAIT ) < 0 ) && primary ) {
+        record_send_error( "sendmsg" );
+      }
+    }
+    return;
+  }
 
-  ssize_t bytes_sent = sendto( sock(), p.data(), p.size(), MSG_DONTWAIT, &remote_addr.sa, remote_addr_len );
+  if ( primary ) {
+    record_send_error( call );
+  }
+}
 
-  if ( bytes_sent != static_cast<ssize_t>( p.size() ) ) {
-    /* Make sendto() failure available to the frontend. */
-    send_error = "sendto: ";
-    send_error += strerror( errno );
+void Connection::send( const Datagram* datagrams, int count )
+{
+  if ( !has_remote_addr ) {
+    return;
+  }
 
-    if ( errno == EMSGSIZE ) {
-      MTU = DEFAULT_SEND_MTU; /* payload MTU of last resort */
+  fatal_assert( count <= SEND_BATCH_MAX );
+
+  /* on the wire: the low 8 bytes of the nonce (as Nonce::cc_str()), then the ciphertext */
+  char nonces[SEND_BATCH_MAX][8];
+  struct iovec wire[SEND_BATCH_MAX][2];
+
+  for ( int i = 0; i < count; i++ ) {
+    /* The payload is gathered into the Session's plaintext buffer behind
+       the packet header, which is its only copy before encryption. */
+    Packet px = new_packet( std::string() );
+    char header[Packet::HEADER_LEN];
+    px.write_header( header );
+
+    static const int MAX_IOV = 8;
+    struct iovec plaintext[MAX_IOV];
+    fatal_assert( datagrams[i].iovcnt < MAX_IOV );
+    plaintext[0].iov_base = header;
+    plaintext[0].iov_len = sizeof( header );
+    for ( int j = 0; j < datagrams[i].iovcnt; j++ ) {
+      plaintext[j + 1] = datagrams[i].iov[j];
     }
+
+    const Nonce nonce = px.nonce();
+    size_t ciphertext_len;
+    char* ciphertext = send_ciphertexts.data() + i * Session::RECEIVE_MTU;
+    session.encrypt( nonce, plaintext, datagrams[i].iovcnt + 1, &ciphertext_len, ciphertext );
+    memcpy( nonces[i], nonce.data() + 4, 8 );
+
+    wire[i][0].iov_base = nonces[i];
+    wire[i][0].iov_len = 8;
+    wire[i][1].iov_base = ciphertext;
+    wire[i][1].iov_len = ciphertext_len;
   }
 
   uint64_t now = timestamp();
+  if ( bound_paths.empty() ) {
+    send_wire( socks.back(), wire, count );
+  } else {
+    int first = 0;
+    while ( first < count ) {
+      if ( datagrams[first].urgent ) {
+        /* the same datagram on every path, and the server takes
+           whichever copy comes first */
+        for ( int n = 0; n < get_path_count(); n++ ) {
+          send_wire( path_socket( n ), wire + first, 1 );
+        }
+        first++;
+        continue;
+      }
+
+      int end = first + 1;
+      while ( ( end < count ) && !datagrams[end].urgent ) {
+        end++;
+      }
+      send_shares( wire + first, end - first, now );
+      first = end;
+    }
+  }
+
   if ( server ) {
     if ( now - last_heard > SERVER_ASSOCIATION_TIMEOUT ) {
       has_remote_addr = false;
@@ -396,101 +848,462 @@ void Connection::send( const std::string& s )
     if ( ( now - last_port_choice > PORT_HOP_INTERVAL ) && ( now - last_roundtrip_success > PORT_HOP_INTERVAL ) ) {
       hop_port();
     }
+    check_local_source( now );
+    rebind_quiet_paths( now );
   }
 }
 
+/* Multipath: bulk goes in contiguous shares to the paths the server is
+   answering on, taking turns at the first share, so datagrams paced out
+   one or two at a time still use every path. */
+void Connection::send_shares( struct iovec ( *wire )[2], int count, uint64_t now )
+{
+  int usable[MAX_PATHS_BOUND + 1];
+  int usable_count = 0;
+  for ( int n = 0; n < get_path_count(); n++ ) {
+    if ( path_usable( n, now ) ) {
+      usable[usable_count++] = n;
+    }
+  }
+  if ( usable_count == 0 ) {
+    usable[usable_count++] = 0;
+  }
+
+  const int shares = std::min( count, usable_count );
+  int first = 0;
+  for ( int j = 0; j < shares; j++ ) {
+    const int end = count * ( j + 1 ) / shares;
+    send_wire( path_socket( usable[( next_share + j ) % usable_count] ), wire + first, end - first );
+    first = end;
+  }
+  next_share = ( next_share + shares ) % usable_count;
+}
+
+/* Sends encrypted datagrams, each a nonce and a ciphertext, on one socket. */
+void Connection::send_wire( Socket& s, struct iovec ( *wire )[2], int count )
+{
+  /* one message per datagram, or per run of equal-sized ones (and a
+     shorter last one) if the kernel will segment it */
+  struct msghdr msgs[SEND_BATCH_MAX];
+  int segments[SEND_BATCH_MAX];
+#ifdef HAVE_UDP_SEGMENT
+  union {
+    char buf[CMSG_SPACE( sizeof( uint16_t ) )];
+    struct cmsghdr align;
+  } control[SEND_BATCH_MAX];
+#endif
+  int msg_count = 0;
+  for ( int i = 0; i < count; i += segments[msg_count++] ) {
+    int n = 1;
+    if ( s.gso() ) {
+      const size_t len = wire[i][1].iov_len;
+      while ( ( i + n < count ) && ( wire[i + n][1].iov_len == len ) ) {
+        n++;
+      }
+      if ( ( i + n < count ) && ( wire[i + n][1].iov_len < len ) ) {
+        n++;
+      }
+    }
+    segments[msg_count] = n;
+
+    struct msghdr& msg = msgs[msg_count];
+    memset( &msg, 0, sizeof( msg ) );
+    msg.msg_name = &remote_addr.sa;
+    msg.msg_namelen = remote_addr_len;
+    msg.msg_iov = wire[i];
+    msg.msg_iovlen = 2 * n;
+
+#ifdef HAVE_UDP_SEGMENT
+    if ( n > 1 ) {
+      msg.msg_control = control[msg_count].buf;
+      msg.msg_controllen = sizeof( control[msg_count].buf );
+      struct cmsghdr* cmsg = CMSG_FIRSTHDR( &msg );
+      cmsg->cmsg_level = SOL_UDP;
+      cmsg->cmsg_type = UDP_SEGMENT;
+      cmsg->cmsg_len = CMSG_LEN( sizeof( uint16_t ) );
+      const uint16_t segment_len = 8 + wire[i][1].iov_len;
+      memcpy( CMSG_DATA( cmsg ), &segment_len, sizeof( segment_len ) );
+    }
+#endif
+  }
+
+#ifdef HAVE_SENDMMSG
+  struct mmsghdr mmsgs[SEND_BATCH_MAX];
+  for ( int i = 0; i < msg_count; i++ ) {
+    mmsgs[i].msg_hdr = msgs[i];
+    mmsgs[i].msg_len = 0;
+  }
+
+  int sent = 0;
+  while ( sent < msg_count ) {
+    int n = sendmmsg( s.fd(), mmsgs + sent, msg_count - sent, MSG_DONTWAIT );
+    if ( n <= 0 ) {
+      /* the message at the head of the batch failed */
+      send_failed( s, msgs[sent], segments[sent], "sendmmsg" );
+      n = 1;
+    }
+    sent += n;
+  }
+#else
+  for ( int i = 0; i < msg_count; i++ ) {
+    if ( sendmsg( s.fd(), &msgs[i], MSG_DONTWAIT ) < 0 ) {
+      send_failed( s, msgs[i], segments[i], "sendmsg" );
+    }
+  }
+#endif
+}
+
 std::string Connection::recv( void )
+{
+  size_t len;
+  const char* payload = recv( &len );
+  return payload ? std::string( payload, len ) : std::string();
+}
+
+const char* Connection::recv( size_t* len )
 {
   assert( !socks.empty() );
+  bool notified = false;
+  if ( !has_queued_datagrams() ) {
+    notified = fill_recv_queue();
+  }
+  skip_duplicates();
+  if ( !has_queued_datagrams() ) {
+    if ( ( recv_count > 0 ) || notified ) {
+      *len = 0;
+      return NULL;
+    }
+    throw NetworkException( "No packet received" );
+  }
+
+  /* advance first, so a datagram that fails to authenticate is dropped, not retried */
+  const int slot = recv_next++;
+  const char* payload = recv_one( recv_queue[slot], recv_payloads.data() + slot * Session::RECEIVE_MTU, len );
+
+  /* succeeded */
+  skip_duplicates();
+  prune_sockets();
+  return payload;
+}
+
+/* Whether a datagram's sequence number was already authenticated, as
+   when a multipath client's copies of it come in on each path.  The
+   nonce has not been checked yet, but a forged one could only make us
+   skip a datagram that would have failed to authenticate. */
+bool Connection::is_duplicate( const Received& r ) const
+{
+  const uint64_t seq = Nonce( r.nonce, sizeof r.nonce ).val() & SEQUENCE_MASK;
+  if ( seq >= expected_receiver_seq ) {
+    return false;
+  }
+  const uint64_t behind = expected_receiver_seq - 1 - seq;
+  return ( behind < DUPLICATE_WINDOW ) && ( ( received_seqs >> behind ) & 1 );
+}
+
+void Connection::skip_duplicates( void )
+{
+  while ( has_queued_datagrams() && is_duplicate( recv_queue[recv_next] ) ) {
+    recv_next++;
+  }
+}
+
+/* ECN field of the IPv4 TOS or IPv6 traffic class in a received datagram's control messages */
+static int received_ecn( struct msghdr* header, int mask )
+{
+  int ecn = 0;
+  for ( struct cmsghdr* ecn_hdr = CMSG_FIRSTHDR( header ); ecn_hdr; ecn_hdr = CMSG_NXTHDR( header, ecn_hdr ) ) {
+    if ( ecn_hdr->cmsg_level == IPPROTO_IP
+         && ( ecn_hdr->cmsg_type == IP_TOS
+#ifdef IP_RECVTOS
+              || ecn_hdr->cmsg_type == IP_RECVTOS
+#endif
+              ) ) {
+      /* got one */
+      uint8_t* ecn_octet_p = (uint8_t*)CMSG_DATA( ecn_hdr );
+      assert( ecn_octet_p );
+
+      ecn = *ecn_octet_p & mask;
+#ifdef IPV6_TCLASS
+    } else if ( ecn_hdr->cmsg_level == IPPROTO_IPV6 && ecn_hdr->cmsg_type == IPV6_TCLASS ) {
+      int tclass;
+      memcpy( &tclass, CMSG_DATA( ecn_hdr ), sizeof( tclass ) );
+
+      ecn = tclass & mask;
+#endif
+    }
+  }
+  return ecn;
+}
+
+/* Read every datagram waiting on any socket, oldest socket first and
+   then the bound paths', up to RECV_BATCH_MAX, with one recvmmsg() per
+   socket where available.  Returns whether there were address change
+   notifications, which move a client to a new port at once. */
+bool Connection::fill_recv_queue( void )
+{
+  recv_next = recv_count = 0;
+
+  /* the rest of a coalesced read that did not fit last time is oldest,
+     and never more than a queue's worth */
+  recv_count += split_coalesced( recv_count );
+
+  const AddressMonitor::Event event = address_monitor.read();
+  if ( event == AddressMonitor::CHANGE ) {
+    local_source_stale = true;
+  }
+  check_local_source( timestamp() );
+
   for ( std::deque<Socket>::const_iterator it = socks.begin(); it != socks.end(); it++ ) {
-    std::string payload;
-    try {
-      payload = recv_one( it->fd() );
-    } catch ( NetworkException& e ) {
-      if ( ( e.the_errno == EAGAIN ) || ( e.the_errno == EWOULDBLOCK ) ) {
+    if ( recv_count == RECV_BATCH_MAX ) {
+      break;
+    }
+
+    const int received = recv_socket( *it, 0 );
+    if ( received < 0 ) {
+      if ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) || ( recv_count > 0 ) ) {
         continue;
-      } else {
-        throw;
       }
+      throw NetworkException( "recvmsg", errno );
     }
+    recv_count += received;
+  }
 
-    /* succeeded */
-    prune_sockets();
-    return payload;
+  /* a bound path's errors leave it to go quiet */
+  for ( size_t n = 0; ( n < bound_paths.size() ) && ( recv_count < RECV_BATCH_MAX ); n++ ) {
+    const int received = recv_socket( bound_paths[n].socket, n + 1 );
+    if ( received > 0 ) {
+      recv_count += received;
+    }
   }
-  throw NetworkException( "No packet received" );
+
+  return event != AddressMonitor::NONE;
 }
 
-std::string Connection::recv_one( int sock_to_recv )
+/* Reads what is waiting on one socket into recv_queue after recv_count.
+   Returns how many, or -1 if the first read fails. */
+int Connection::recv_socket( const Socket& s, int path_received )
 {
-  /* receive source address, ECN, and payload in msghdr structure */
-  Addr packet_remote_addr;
-  struct msghdr header;
-  struct iovec msg_iovec;
+  char msg_control[RECV_BATCH_MAX][RECV_CONTROL_LEN];
+  struct iovec msg_iovec[RECV_BATCH_MAX][2];
+  struct msghdr msgs[RECV_BATCH_MAX];
 
-  char msg_payload[Session::RECEIVE_MTU];
-  char msg_control[Session::RECEIVE_MTU];
+  const int budget = RECV_BATCH_MAX - recv_count;
 
-  /* receive source address */
-  header.msg_name = &packet_remote_addr;
-  header.msg_namelen = sizeof packet_remote_addr;
+  int received = 0;
+  if ( s.gro() ) {
+    received = recv_coalesced( s.fd(), path_received );
+  } else {
+    for ( int i = recv_count; i < RECV_BATCH_MAX; i++ ) {
+      /* receive source address, ECN, and payload in msghdr structure */
+      msgs[i].msg_name = &recv_queue[i].addr;
+      msgs[i].msg_namelen = sizeof recv_queue[i].addr;
+      msg_iovec[i][0].iov_base = recv_queue[i].nonce;
+      msg_iovec[i][0].iov_len = sizeof recv_queue[i].nonce;
+      msg_iovec[i][1].iov_base = recv_payloads.data() + i * Session::RECEIVE_MTU;
+      msg_iovec[i][1].iov_len = Session::RECEIVE_MTU;
+      msgs[i].msg_iov = msg_iovec[i];
+      msgs[i].msg_iovlen = 2;
+      msgs[i].msg_control = msg_control[i];
+      msgs[i].msg_controllen = RECV_CONTROL_LEN;
+      msgs[i].msg_flags = 0;
+    }
 
-  /* receive payload */
-  msg_iovec.iov_base = msg_payload;
-  msg_iovec.iov_len = sizeof msg_payload;
-  header.msg_iov = &msg_iovec;
-  header.msg_iovlen = 1;
+#ifdef HAVE_RECVMMSG
+    struct mmsghdr mmsgs[RECV_BATCH_MAX];
+    for ( int i = 0; i < budget; i++ ) {
+      mmsgs[i].msg_hdr = msgs[recv_count + i];
+      mmsgs[i].msg_len = 0;
+    }
+    received = recvmmsg( s.fd(), mmsgs, budget, MSG_DONTWAIT, NULL );
+    for ( int i = 0; i < received; i++ ) {
+      msgs[recv_count + i] = mmsgs[i].msg_hdr;
+      recv_queue[recv_count + i].len = mmsgs[i].msg_len;
+    }
+#else
+    while ( received < budget ) {
+      ssize_t len = recvmsg( s.fd(), &msgs[recv_count + received], MSG_DONTWAIT );
+      if ( len < 0 ) {
+        if ( received == 0 ) {
+          received = -1;
+        }
+        break;
+      }
+      recv_queue[recv_count + received].len = len;
+      received++;
+    }
+#endif
 
-  /* receive explicit congestion notification */
-  header.msg_control = msg_control;
-  header.msg_controllen = sizeof msg_control;
+    for ( int i = recv_count; i < recv_count + received; i++ ) {
+      /* a datagram too short for its nonce fails authentication as one without a tag */
+      const size_t nonce_len = sizeof recv_queue[i].nonce;
+      recv_queue[i].len = recv_queue[i].len > nonce_len ? recv_queue[i].len - nonce_len : 0;
+      recv_queue[i].addr_len = msgs[i].msg_namelen;
+      recv_queue[i].ecn = received_ecn( &msgs[i], ECN_MASK );
+      recv_queue[i].truncated = msgs[i].msg_flags & MSG_TRUNC;
+    }
+  }
 
-  /* receive flags */
-  header.msg_flags = 0;
+  for ( int i = recv_count; i < recv_count + received; i++ ) {
+    recv_queue[i].path = path_received;
+  }
+  return received;
+}
 
-  ssize_t received_len = recvmsg( sock_to_recv, &header, MSG_DONTWAIT );
+/* Read datagrams from a socket with UDP_GRO, which may deliver a run of
+   them in one read, until it would block or recv_queue is full, and
+   copy each into recv_queue and an aligned slot.  Returns how many, or
+   -1 if the first read fails. */
+int Connection::recv_coalesced( int sock_to_recv, int path_received )
+{
+  int received = 0;
+  while ( recv_count + received < RECV_BATCH_MAX ) {
+    Coalesced& c = gro_pending;
+    char msg_control[RECV_CONTROL_LEN];
+    struct iovec msg_iovec;
+    struct msghdr msg;
+
+    msg.msg_name = &c.addr;
+    msg.msg_namelen = sizeof c.addr;
+    msg_iovec.iov_base = gro_buffer.data();
+    msg_iovec.iov_len = gro_buffer.len();
+    msg.msg_iov = &msg_iovec;
+    msg.msg_iovlen = 1;
+    msg.msg_control = msg_control;
+    msg.msg_controllen = sizeof msg_control;
+    msg.msg_flags = 0;
+
+    const ssize_t len = recvmsg( sock_to_recv, &msg, MSG_DONTWAIT );
+    if ( len < 0 ) {
+      return received > 0 ? received : -1;
+    }
 
-  if ( received_len < 0 ) {
-    throw NetworkException( "recvmsg", errno );
+    /* without the control message, it is a single datagram */
+    c.segment_len = len;
+#ifdef HAVE_UDP_GRO
+    for ( struct cmsghdr* cmsg = CMSG_FIRSTHDR( &msg ); cmsg; cmsg = CMSG_NXTHDR( &msg, cmsg ) ) {
+      if ( ( cmsg->cmsg_level == SOL_UDP ) && ( cmsg->cmsg_type == UDP_GRO ) ) {
+        int gro_size;
+        memcpy( &gro_size, CMSG_DATA( cmsg ), sizeof( gro_size ) );
+        c.segment_len = std::max( gro_size, 1 );
+      }
+    }
+#endif
+    c.addr_len = msg.msg_namelen;
+    c.len = len;
+    c.offset = 0;
+    c.ecn = received_ecn( &msg, ECN_MASK );
+    c.truncated = msg.msg_flags & MSG_TRUNC;
+    c.path = path_received;
+
+    received += split_coalesced( recv_count + received );
   }
+  return received;
+}
 
-  if ( header.msg_flags & MSG_TRUNC ) {
-    throw NetworkException( "Received oversize datagram", errno );
+/* Queue the segments of gro_pending not yet queued, from first_slot
+   until recv_queue is full.  Returns how many. */
+int Connection::split_coalesced( int first_slot )
+{
+  Coalesced& c = gro_pending;
+  int slot = first_slot;
+  while ( ( c.offset < c.len ) && ( slot < RECV_BATCH_MAX ) ) {
+    Received& r = recv_queue[slot];
+    const size_t datagram_len = std::min( c.segment_len, c.len - c.offset );
+    const char* datagram = gro_buffer.data() + c.offset;
+    c.offset += datagram_len;
+
+    r.addr = c.addr;
+    r.addr_len = c.addr_len;
+    r.ecn = c.ecn;
+    r.truncated = c.truncated || ( datagram_len > sizeof r.nonce + Session::RECEIVE_MTU );
+    r.path = c.path;
+    memcpy( r.nonce, datagram, std::min( datagram_len, sizeof r.nonce ) );
+    r.len = ( !r.truncated && ( datagram_len > sizeof r.nonce ) ) ? datagram_len - sizeof r.nonce : 0;
+    memcpy( recv_payloads.data() + slot * Session::RECEIVE_MTU, datagram + sizeof r.nonce, r.len );
+    slot++;
   }
+  return slot - first_slot;
+}
 
-  /* receive ECN */
-  bool congestion_experienced = false;
+static void update_RTT( bool& RTT_hit, double& SRTT, double& RTTVAR, double R )
+{
+  if ( !RTT_hit ) { /* first measurement */
+    SRTT = R;
+    RTTVAR = R / 2;
+    RTT_hit = true;
+  } else {
+    const double alpha = 1.0 / 8.0;
+    const double beta = 1.0 / 4.0;
 
-  struct cmsghdr* ecn_hdr = CMSG_FIRSTHDR( &header );
-  if ( ecn_hdr && ecn_hdr->cmsg_level == IPPROTO_IP
-       && ( ecn_hdr->cmsg_type == IP_TOS
-#ifdef IP_RECVTOS
-            || ecn_hdr->cmsg_type == IP_RECVTOS
-#endif
-            ) ) {
-    /* got one */
-    uint8_t* ecn_octet_p = (uint8_t*)CMSG_DATA( ecn_hdr );
-    assert( ecn_octet_p );
+    RTTVAR = ( 1 - beta ) * RTTVAR + ( beta * fabs( SRTT - R ) );
+    SRTT = ( 1 - alpha ) * SRTT + ( alpha * R );
+  }
+}
 
-    congestion_experienced = ( *ecn_octet_p & 0x03 ) == 0x03;
+const char* Connection::recv_one( const Received& r, char* body, size_t* len )
+{
+  if ( r.truncated ) {
+    throw NetworkException( "Received oversize datagram", 0 );
   }
 
-  Packet p( session.decrypt( msg_payload, received_len ) );
+  const int ecn = r.ecn;
+  const bool congestion_experienced = ( ecn == ECN_CE );
 
-  dos_assert( p.direction == ( server ? TO_SERVER : TO_CLIENT ) ); /* prevent malicious playback to sender */
+  const Nonce nonce( r.nonce, sizeof r.nonce );
+  const size_t plaintext_len = session.decrypt( nonce, body, r.len );
+
+  /* as in Packet( const Message& ), without copying the payload out */
+  const uint64_t packet_seq = nonce.val() & SEQUENCE_MASK;
+  const Direction packet_direction = ( nonce.val() & DIRECTION_MASK ) ? TO_CLIENT : TO_SERVER;
+  uint16_t packet_timestamp, packet_timestamp_reply;
+  dos_assert( plaintext_len >= Packet::HEADER_LEN );
+  Packet::read_header( body, &packet_timestamp, &packet_timestamp_reply );
+  *len = plaintext_len - Packet::HEADER_LEN;
+  const char* payload = body + Packet::HEADER_LEN;
+
+  dos_assert( packet_direction == ( server ? TO_SERVER : TO_CLIENT ) ); /* prevent malicious playback to sender */
+
+  /* count only authenticated datagrams, so the counts can't be forged */
+  if ( congestion_experienced ) {
+    ecn_ce_received++;
+  } else if ( ecn != 0 ) {
+    ecn_ect_received++;
+  }
 
-  if ( p.seq
+  PathStats& stats = path_stats( r.path );
+  stats.received++;
+  stats.last_heard = timestamp();
+
+  if ( packet_seq
        < expected_receiver_seq ) { /* don't use (but do return) out-of-order packets for timestamp or targeting */
-    return p.payload;
+    const uint64_t behind = expected_receiver_seq - 1 - packet_seq;
+    if ( behind < DUPLICATE_WINDOW ) {
+      received_seqs |= uint64_t( 1 ) << behind;
+    }
+    return payload;
+  }
+
+  /* The server sends on one path at a time, so datagrams missing between
+     two that came in on the same path were lost on it (or reordered). */
+  const uint64_t gap = packet_seq - expected_receiver_seq;
+  const double loss_gain = 1.0 / 16.0;
+  if ( ( expected_receiver_seq > 0 ) && ( r.path == last_path ) ) {
+    for ( uint64_t i = 0; i < std::min( gap, uint64_t( DUPLICATE_WINDOW ) ); i++ ) {
+      stats.loss += loss_gain * ( 1 - stats.loss );
+    }
   }
-  expected_receiver_seq = p.seq + 1; /* this is security-sensitive because a replay attack could otherwise
-                                        screw up the timestamp and targeting */
+  stats.loss -= loss_gain * stats.loss;
+  last_path = r.path;
 
-  if ( p.timestamp != uint16_t( -1 ) ) {
-    saved_timestamp = p.timestamp;
+  received_seqs = ( gap + 1 < DUPLICATE_WINDOW ) ? ( ( received_seqs << ( gap + 1 ) ) | 1 ) : 1;
+  expected_receiver_seq = packet_seq + 1; /* this is security-sensitive because a replay attack could otherwise
+                                             screw up the timestamp and targeting */
+
+  if ( packet_timestamp != uint16_t( -1 ) ) {
+    saved_timestamp = packet_timestamp;
     saved_timestamp_received_at = timestamp();
 
-    if ( congestion_experienced ) {
+    if ( congestion_experienced && !ecn_feedback ) {
       /* signal counterparty to slow down */
       /* this will gradually slow the counterparty down to the minimum frame rate */
       saved_timestamp -= CONGESTION_TIMESTAMP_PENALTY;
@@ -500,21 +1313,16 @@ std::string Connection::recv_one( int sock_to_recv )
     }
   }
 
-  if ( p.timestamp_reply != uint16_t( -1 ) ) {
+  if ( packet_timestamp_reply != uint16_t( -1 ) ) {
     uint16_t now = timestamp16();
-    double R = timestamp_diff( now, p.timestamp_reply );
-
-    if ( R < 5000 ) {   /* ignore large values, e.g. server was Ctrl-Zed */
-      if ( !RTT_hit ) { /* first measurement */
-        SRTT = R;
-        RTTVAR = R / 2;
-        RTT_hit = true;
-      } else {
-        const double alpha = 1.0 / 8.0;
-        const double beta = 1.0 / 4.0;
-
-        RTTVAR = ( 1 - beta ) * RTTVAR + ( beta * fabs( SRTT - R ) );
-        SRTT = ( 1 - alpha ) * SRTT + ( alpha * R );
+    double R = timestamp_diff( now, packet_timestamp_reply );
+
+    if ( R < 5000 ) { /* ignore large values, e.g. server was Ctrl-Zed */
+      last_RTT = R;
+      RTT_samples++;
+      update_RTT( RTT_hit, SRTT, RTTVAR, R );
+      if ( !bound_paths.empty() ) { /* the round trip of the path it came back on */
+        update_RTT( stats.RTT_hit, stats.SRTT, stats.RTTVAR, R );
       }
     }
   }
@@ -524,10 +1332,18 @@ std::string Connection::recv_one( int sock_to_recv )
   last_heard = timestamp();
 
   if ( server && /* only client can roam */
-       ( remote_addr_len != header.msg_namelen
-         || memcmp( &remote_addr, &packet_remote_addr, remote_addr_len ) != 0 ) ) {
-    remote_addr = packet_remote_addr;
-    remote_addr_len = header.msg_namelen;
+       ( remote_addr_len != r.addr_len || memcmp( &remote_addr, &r.addr, remote_addr_len ) != 0 ) ) {
+    /* a multipath client's paths take turns being first, which is not news */
+    const bool returning
+      = ( previous_remote_addr_len == r.addr_len ) && ( memcmp( &previous_remote_addr, &r.addr, r.addr_len ) == 0 );
+    previous_remote_addr = remote_addr;
+    previous_remote_addr_len = remote_addr_len;
+    remote_addr = r.addr;
+    remote_addr_len = r.addr_len;
+    set_path();
+    if ( returning ) {
+      return payload;
+    }
     char host[NI_MAXHOST], serv[NI_MAXSERV];
     int errcode = getnameinfo( &remote_addr.sa,
                                remote_addr_len,
@@ -541,7 +1357,7 @@ std::string Connection::recv_one( int sock_to_recv )
     }
     fprintf( stderr, "Server now attached to client at %s:%s\n", host, serv );
   }
-  return p.payload;
+  return payload;
 }
 
 std::string Connection::port( void ) const
@@ -605,7 +1421,9 @@ Connection::Socket::~Socket()
   fatal_assert( close( _fd ) == 0 );
 }
 
-Connection::Socket::Socket( const Socket& other ) : _fd( dup( other._fd ) )
+Connection::Socket::Socket( const Socket& other )
+  : _fd( dup( other._fd ) ), _family( other._family ), _gso( other._gso ), _gro( other._gro ),
+    _df( other._df )
 {
   if ( _fd < 0 ) {
     throw NetworkException( "socket", errno );
@@ -617,6 +1435,10 @@ Connection::Socket& Connection::Socket::operator=( const Socket& other )
   if ( dup2( other._fd, _fd ) < 0 ) {
     throw NetworkException( "socket", errno );
   }
+  _family = other._family;
+  _gso = other._gso;
+  _gro = other._gro;
+  _df = other._df;
 
   return *this;
 }
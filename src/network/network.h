@@ -39,19 +39,36 @@
 #include <cstring>
 #include <deque>
 #include <exception>
+#include <map>
 #include <string>
 #include <vector>
 
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 
 #include "src/crypto/crypto.h"
+#include "src/network/addressmonitor.h"
+#include "src/network/pathmtu.h"
 
 using namespace Crypto;
 
 namespace Network {
 static const unsigned int MOSH_PROTOCOL_VERSION = 2; /* bumped for echo-ack */
 
+/* Optional features, advertised in every instruction.  A peer that
+   predates a feature never sets its bit, so the old format stays in use. */
+static const uint32_t CAPABILITY_CELL_DIFF = 1 << 0;          /* applies HostBuffers::FrameUpdate */
+static const uint32_t CAPABILITY_DEFLATE_DICTIONARY = 1 << 1; /* inflates with Compressor's preset dictionary */
+static const uint32_t CAPABILITY_ZSTD = 1 << 2;               /* uncompresses the zstd codec */
+static const uint32_t CAPABILITY_LZ4 = 1 << 3;                /* uncompresses the lz4 codec */
+static const uint32_t CAPABILITY_STORED = 1 << 4;             /* takes uncompressed payloads */
+static const uint32_t CAPABILITY_PARITY = 1 << 5;             /* rebuilds lost fragments from parity fragments */
+static const uint32_t CAPABILITY_ECN_FEEDBACK = 1 << 6;       /* reports ECN counts, and responds to them */
+
+/* Features of Network::Transport itself, advertised whatever the frontend sets */
+static const uint32_t TRANSPORT_CAPABILITIES = CAPABILITY_PARITY | CAPABILITY_ECN_FEEDBACK;
+
 uint64_t timestamp( void );
 uint16_t timestamp16( void );
 uint16_t timestamp_diff( uint16_t tsnew, uint16_t tsold );
@@ -95,6 +112,12 @@ public:
   Packet( const Message& message );
 
   Message toMessage( void );
+
+  /* the wire form is the timestamps followed by the payload */
+  static const size_t HEADER_LEN = 2 * sizeof( uint16_t );
+  Nonce nonce( void ) const;
+  void write_header( char* buf ) const;
+  static void read_header( const char* buf, uint16_t* timestamp, uint16_t* timestamp_reply );
 };
 
 union Addr {
@@ -128,13 +151,15 @@ private:
    *
    * As of July 2016, VPN traffic over Amtrak Acela wifi seems to be
    * dropped if tunnelled packets are 1320 bytes or larger.  Use a
-   * 1280-byte IPv4 MTU for now.
-   *
-   * We may have to implement ICMP-less PMTUD (RFC 4821) eventually.
+   * 1280-byte IPv4 MTU to start with; PathMTU probes for more.
    */
   static const int DEFAULT_IPV4_MTU = 1280;
   /* IPv6 MTU. Use the guaranteed minimum to avoid fragmentation. */
   static const int DEFAULT_IPV6_MTU = 1280;
+  /* Largest IP packet MTU probes try: Ethernet's. */
+  static const int MAX_PROBE_MTU = 1500;
+  /* Remote addresses whose path MTU is remembered. */
+  static const size_t MAX_PATHS = 16;
 
   static const uint64_t MIN_RTO = 50;   /* ms */
   static const uint64_t MAX_RTO = 1000; /* ms */
@@ -144,36 +169,121 @@ private:
 
   static const unsigned int SERVER_ASSOCIATION_TIMEOUT = 40000;
   static const unsigned int PORT_HOP_INTERVAL = 10000;
+  static const unsigned int ADDRESS_HOP_INTERVAL = 1000; /* ms between hops for address changes */
 
   static const unsigned int MAX_PORTS_OPEN = 10;
   static const unsigned int MAX_OLD_SOCKET_AGE = 60000;
 
   static const int CONGESTION_TIMESTAMP_PENALTY = 500; /* ms */
 
+  static const int RECV_BATCH_MAX = 64; /* datagrams drained per refill */
+
+  /* UDP segmentation offload (Linux): one system call carries a run of
+     equal-sized datagrams, the last of which may be shorter, and the
+     kernel coalesces such runs on receive unless they are forwarded */
+  static const int GRO_MAX_SEGMENTS = 64; /* UDP_MAX_SEGMENTS */
+  static const int GRO_BUFFER_LEN = 65536;
+
+  static const size_t RECV_CONTROL_LEN = 128; /* room for the ECN and GRO control messages */
+
+  static const unsigned int MAX_PATHS_BOUND = 8;        /* local addresses in multipath mode */
+  static const unsigned int PATH_QUIET_INTERVAL = 5000; /* ms unheard before a path carries no bulk */
+  static const int DUPLICATE_WINDOW = 64;               /* sequence numbers behind the newest still checked */
+
+  /* ECN field of the IPv4 TOS or IPv6 traffic class */
+  static const int ECN_MASK = 0x03;
+  static const int ECN_ECT0 = 0x02; /* classic ECN-capable transport */
+  static const int ECN_ECT1 = 0x01; /* ... with a scalable (L4S) congestion response */
+  static const int ECN_CE = 0x03;   /* congestion experienced */
+
   bool try_bind( const char* addr, int port_low, int port_high );
 
   class Socket
   {
   private:
     int _fd;
+    int _family;
+    bool _gso; /* UDP_SEGMENT accepted */
+    bool _gro; /* UDP_GRO enabled */
+    bool _df;  /* can set the don't-fragment bit */
 
   public:
     int fd( void ) const { return _fd; }
+    bool gso( void ) const { return _gso; }
+    bool gro( void ) const { return _gro; }
+    void disable_gso( void ) { _gso = false; }
+    bool can_probe( void ) const { return _df; }
     Socket( int family );
     ~Socket();
 
+    void set_ecn( int codepoint ) const;
+    bool set_dont_fragment( bool df ) const;
+
     Socket( const Socket& other );
     Socket& operator=( const Socket& other );
   };
 
   std::deque<Socket> socks;
+
+public:
+  /* What a client knows of each of its paths to the server, from the
+     datagrams that came back on it. */
+  struct PathStats
+  {
+    uint64_t last_heard;
+    bool RTT_hit;
+    double SRTT;
+    double RTTVAR;
+    double loss;       /* moving average of the fraction of the server's datagrams lost */
+    uint64_t received; /* authenticated datagrams */
+
+    PathStats() : last_heard( 0 ), RTT_hit( false ), SRTT( 1000 ), RTTVAR( 500 ), loss( 0 ), received( 0 ) {}
+  };
+
+private:
+  /* Multipath (client): sockets bound to further local addresses, such
+     as a second interface's.  Latency-critical datagrams go out on
+     every path and bulk is spread across those that work; the server
+     answers on whichever copy reached it first.  Path 0 is the
+     primary socket, socks.back(), whose address the system picks. */
+  class BoundPath
+  {
+  public:
+    std::string name; /* as the user gave it */
+    Addr local;
+    socklen_t local_len;
+    Socket socket;
+    uint64_t bound_at;
+    PathStats stats;
+
+    BoundPath( const std::string& s_name, const Addr& s_local, socklen_t s_local_len );
+  };
+  std::vector<BoundPath> bound_paths;
+  PathStats primary_stats;
+  int last_path;  /* that the newest datagram came in on */
+  int next_share; /* usable path, counted round, to take the next share of bulk */
+
+  PathStats& path_stats( int n ) { return n == 0 ? primary_stats : bound_paths[n - 1].stats; }
+  Socket& path_socket( int n ) { return n == 0 ? socks.back() : bound_paths[n - 1].socket; }
+  bool path_usable( int n, uint64_t now );
+  void rebind_quiet_paths( uint64_t now );
+
   bool has_remote_addr;
   Addr remote_addr;
   socklen_t remote_addr_len;
+  Addr previous_remote_addr; /* server: where the client was before */
+  socklen_t previous_remote_addr_len;
 
   bool server;
 
-  int MTU; /* application datagram MTU */
+  int MTU; /* application datagram MTU, until there is a path */
+
+  /* Path MTU discovery, by remote address (less the port, so that it
+     outlives port hops and a client's roaming back). */
+  using path_map_type = std::map<std::string, PathMTU>;
+  path_map_type paths;
+  PathMTU* path; /* of remote_addr */
+  int probing;   /* size of the probe being sent, or 0 */
 
   Base64Key key;
   Session session;
@@ -184,21 +294,81 @@ private:
   uint16_t saved_timestamp;
   uint64_t saved_timestamp_received_at;
   uint64_t expected_receiver_seq;
+  uint64_t received_seqs; /* bit i: expected_receiver_seq - 1 - i was authenticated */
 
   uint64_t last_heard;
   uint64_t last_port_choice;
+
+  /* client: hops to a new port as soon as the address it would send to
+     the server from changes */
+  AddressMonitor address_monitor;
+  std::string local_source;   /* that address, as set_path()'s keys, or empty with no route */
+  bool local_source_stale;    /* notifications came since it was looked up */
+  uint64_t last_address_hop;
+  bool local_address_changed; /* since the transport last asked */
+
   uint64_t last_roundtrip_success; /* transport layer needs to tell us this */
 
   bool RTT_hit;
   double SRTT;
   double RTTVAR;
+  double last_RTT;     /* most recent sample */
+  uint64_t RTT_samples; /* ... and how many there have been */
 
-  /* Error from send()/sendto(). */
+  /* Once the peer reports ECN counts, we mark datagrams ECT(1) and
+     leave the response to its sender, instead of penalizing the
+     timestamps we echo. */
+  bool ecn_feedback;
+  uint64_t ecn_ect_received; /* authenticated datagrams marked ECT(0) or ECT(1) */
+  uint64_t ecn_ce_received;  /* ... or CE */
+
+  /* Error from send()/sendmsg(). */
   std::string send_error;
 
+  /* Datagrams read from the sockets in one batch but not yet
+     processed.  Each nonce is read in front of its ciphertext, which
+     lands at the start of an aligned RECEIVE_MTU-sized slot of
+     recv_payloads (copied there, after a coalesced read) and is
+     decrypted there. */
+  struct Received
+  {
+    Addr addr;
+    socklen_t addr_len;
+    char nonce[8];
+    size_t len; /* of the ciphertext */
+    int ecn;
+    bool truncated;
+    int path;
+  };
+  Received recv_queue[RECV_BATCH_MAX];
+  AlignedBuffer recv_payloads;
+  int recv_next;
+  int recv_count;
+
+  /* ciphertexts of the batch being sent, also in RECEIVE_MTU-sized slots */
+  AlignedBuffer send_ciphertexts;
+
+  /* a coalesced read, before it is split into recv_queue; segments
+     past a full queue wait here and are queued first on the next refill */
+  AlignedBuffer gro_buffer;
+  struct Coalesced
+  {
+    Addr addr;
+    socklen_t addr_len;
+    ssize_t len;    /* read into gro_buffer */
+    ssize_t offset; /* of the next segment not yet queued */
+    ssize_t segment_len;
+    int ecn;
+    bool truncated;
+    int path;
+  };
+  Coalesced gro_pending;
+
   Packet new_packet( const std::string& s_payload );
 
   void hop_port( void );
+  std::string source_address( void ) const;
+  void check_local_source( uint64_t now );
 
   int sock( void ) const
   {
@@ -208,9 +378,23 @@ private:
 
   void prune_sockets( void );
 
-  std::string recv_one( int sock_to_recv );
+  bool fill_recv_queue( void );
+  int recv_socket( const Socket& s, int path );
+  int recv_coalesced( int sock_to_recv, int path );
+  int split_coalesced( int first_slot );
+  bool is_duplicate( const Received& r ) const;
+  void skip_duplicates( void );
+  const char* recv_one( const Received& r, char* body, size_t* len );
+  void record_send_error( const char* call );
+  void send_wire( Socket& s, struct iovec ( *wire )[2], int count );
+  void send_shares( struct iovec ( *wire )[2], int count, uint64_t now );
+  void send_failed( Socket& s, const struct msghdr& msg, int segments, const char* call );
 
   void set_MTU( int family );
+  void set_path( void );
+
+  Connection( const Connection& );
+  Connection& operator=( const Connection& );
 
 public:
   /* Network transport overhead. */
@@ -219,10 +403,48 @@ public:
   Connection( const char* desired_ip, const char* desired_port );      /* server */
   Connection( const char* key_str, const char* ip, const char* port ); /* client */
 
+  /* One datagram of a batch: the concatenation of iovcnt buffers.  In
+     multipath mode an urgent one, such as a keystroke or an ack, goes
+     out on every path, and the rest are spread across them. */
+  struct Datagram
+  {
+    const struct iovec* iov;
+    int iovcnt;
+    bool urgent;
+  };
+  static const int SEND_BATCH_MAX = 16;
+
   void send( const std::string& s );
+  /* send the concatenation of iovcnt buffers as one datagram */
+  void send( const struct iovec* iov, int iovcnt );
+  /* send up to SEND_BATCH_MAX datagrams with as few system calls as possible */
+  void send( const Datagram* datagrams, int count );
+  /* Returns the next datagram's payload, reading every datagram
+     already waiting on the sockets (up to RECV_BATCH_MAX) when none
+     is queued.  The payload is decrypted in place in the Connection's
+     receive buffer and valid until the next recv().  Returns NULL if
+     what was waiting were only copies of datagrams already received. */
+  const char* recv( size_t* len );
   std::string recv( void );
+  bool has_queued_datagrams( void ) const { return recv_next < recv_count; }
   const std::vector<int> fds( void ) const;
-  int get_MTU( void ) const { return MTU; }
+  int get_MTU( void ) const { return path ? path->get() : MTU; }
+
+  /* Path MTU probes: the size to send one of now, or 0 */
+  int get_MTU_probe( void ) const;
+  /* sends a datagram of that size that routers may not fragment;
+     false if it could not go, as when it is too big for the interface */
+  bool send_MTU_probe( const struct iovec* iov, int iovcnt, int size );
+  void MTU_probe_acked( int size );
+  void MTU_probe_lost( int size );
+  /* datagrams of the full MTU are not getting through */
+  void MTU_black_hole( void );
+
+  /* Multipath: adds a path from a local address or interface (client) */
+  void add_path( const std::string& local );
+  int get_path_count( void ) const { return 1 + bound_paths.size(); }
+  std::string get_path_name( int n ) const { return n == 0 ? "default" : bound_paths[n - 1].name; }
+  const PathStats& get_path_stats( int n ) const { return n == 0 ? primary_stats : bound_paths[n - 1].stats; }
 
   std::string port( void ) const;
   std::string get_key( void ) const { return key.printable_key(); }
@@ -230,6 +452,12 @@ public:
 
   uint64_t timeout( void ) const;
   double get_SRTT( void ) const { return SRTT; }
+  double get_last_RTT( void ) const { return last_RTT; }
+  uint64_t get_RTT_samples( void ) const { return RTT_samples; }
+
+  void set_ecn_feedback( bool s_ecn_feedback );
+  uint64_t get_ecn_ect_received( void ) const { return ecn_ect_received; }
+  uint64_t get_ecn_ce_received( void ) const { return ecn_ce_received; }
 
   const Addr& get_remote_addr( void ) const { return remote_addr; }
   socklen_t get_remote_addr_len( void ) const { return remote_addr_len; }
@@ -238,6 +466,14 @@ public:
 
   void set_last_roundtrip_success( uint64_t s_success ) { last_roundtrip_success = s_success; }
 
+  /* whether a local address changed since the last call, so the server should hear from us now */
+  bool take_local_address_change( void )
+  {
+    const bool changed = local_address_changed;
+    local_address_changed = false;
+    return changed;
+  }
+
   static bool parse_portrange( const char* desired_port_range, int& desired_port_low, int& desired_port_high );
 };
 }
@@ -46,7 +46,8 @@ Transport<MyState, RemoteState>::Transport( MyState& initial_state,
                                             const char* desired_port )
   : connection( desired_ip, desired_port ), sender( &connection, initial_state ),
     received_states( 1, TimestampedState<RemoteState>( timestamp(), 0, initial_remote ) ),
-    receiver_quench_timer( 0 ), last_receiver_state( initial_remote ), fragments(), verbose( 0 )
+    receiver_quench_timer( 0 ), last_receiver_state( initial_remote ), fragments(), verbose( 0 ),
+    remote_capabilities( 0 )
 {
   /* server */
 }
@@ -59,7 +60,8 @@ Transport<MyState, RemoteState>::Transport( MyState& initial_state,
                                             const char* port )
   : connection( key_str, ip, port ), sender( &connection, initial_state ),
     received_states( 1, TimestampedState<RemoteState>( timestamp(), 0, initial_remote ) ),
-    receiver_quench_timer( 0 ), last_receiver_state( initial_remote ), fragments(), verbose( 0 )
+    receiver_quench_timer( 0 ), last_receiver_state( initial_remote ), fragments(), verbose( 0 ),
+    remote_capabilities( 0 )
 {
   /* client */
 }
@@ -67,40 +69,58 @@ Transport<MyState, RemoteState>::Transport( MyState& initial_state,
 template<class MyState, class RemoteState>
 void Transport<MyState, RemoteState>::recv( void )
 {
-  std::string s( connection.recv() );
-  Fragment frag( s );
+  /* drain everything before the caller looks at the new state */
+  do {
+    size_t len;
+    const char* s = connection.recv( &len );
+    if ( s ) { /* not just copies of datagrams already received */
+      process_datagram( s, len );
+    }
+  } while ( connection.has_queued_datagrams() );
+
+  /* on a new local address, let the server hear from it without waiting */
+  if ( connection.take_local_address_change() ) {
+    sender.set_ack_now();
+    if ( verbose ) {
+      fprintf(
+        stderr, "[%u] Local address changed, moved to a new port\n", (unsigned int)( timestamp() % 100000 ) );
+    }
+  }
+}
+
+template<class MyState, class RemoteState>
+void Transport<MyState, RemoteState>::process_datagram( const char* s, size_t len )
+{
+  FragmentView frag( s, len );
 
   if ( fragments.add_fragment( frag ) ) { /* complete packet */
-    Instruction inst = fragments.get_assembly();
+    const Instruction& inst = fragments.get_assembly();
 
     if ( inst.protocol_version() != MOSH_PROTOCOL_VERSION ) {
       throw NetworkException( "mosh protocol version mismatch", 0 );
     }
 
+    remote_capabilities = inst.capabilities();
+    sender.set_remote_capabilities( remote_capabilities );
+    connection.set_ecn_feedback( remote_capabilities & CAPABILITY_ECN_FEEDBACK );
+    if ( inst.has_ecn_ce() ) {
+      sender.process_ecn_counts( inst.ecn_ect(), inst.ecn_ce() );
+    }
+
     sender.process_acknowledgment_through( inst.ack_num() );
 
     /* inform network layer of roundtrip (end-to-end-to-end) connectivity */
     connection.set_last_roundtrip_success( sender.get_sent_state_acked_timestamp() );
 
     /* first, make sure we don't already have the new state */
-    for ( typename std::list<TimestampedState<RemoteState>>::iterator i = received_states.begin();
-          i != received_states.end();
-          i++ ) {
-      if ( inst.new_num() == i->num ) {
-        return;
-      }
+    typename received_states_type::iterator duplicate = lower_bound_num( received_states, inst.new_num() );
+    if ( ( duplicate != received_states.end() ) && ( duplicate->num == inst.new_num() ) ) {
+      return;
     }
 
     /* now, make sure we do have the old state */
-    bool found = 0;
-    typename std::list<TimestampedState<RemoteState>>::iterator reference_state = received_states.begin();
-    while ( reference_state != received_states.end() ) {
-      if ( inst.old_num() == reference_state->num ) {
-        found = true;
-        break;
-      }
-      reference_state++;
-    }
+    typename received_states_type::iterator reference_state = lower_bound_num( received_states, inst.old_num() );
+    const bool found = ( reference_state != received_states.end() ) && ( reference_state->num == inst.old_num() );
 
     if ( !found ) {
       //    fprintf( stderr, "Ignoring out-of-order packet. Reference state %d has been discarded or hasn't yet been
@@ -115,7 +135,7 @@ void Transport<MyState, RemoteState>::recv( void )
 
     process_throwaway_until( inst.throwaway_num() );
 
-    if ( received_states.size() > 1024 ) { /* limit on state queue */
+    if ( received_states.size() > RECEIVED_STATES_MAX ) { /* limit on state queue */
       uint64_t now = timestamp();
       if ( now < receiver_quench_timer ) { /* deny letting state grow further */
         if ( verbose ) {
@@ -141,34 +161,35 @@ void Transport<MyState, RemoteState>::recv( void )
     }
 
     /* Insert new state in sorted place */
-    for ( typename std::list<TimestampedState<RemoteState>>::iterator i = received_states.begin();
-          i != received_states.end();
-          i++ ) {
-      if ( i->num > new_state.num ) {
-        received_states.insert( i, new_state );
-        if ( verbose ) {
-          fprintf( stderr,
-                   "[%u] Received OUT-OF-ORDER state %d [ack %d]\n",
-                   (unsigned int)( timestamp() % 100000 ),
-                   (int)new_state.num,
-                   (int)inst.ack_num() );
-        }
-        return;
+    typename received_states_type::iterator i = lower_bound_num( received_states, new_state.num );
+    if ( i != received_states.end() ) {
+      received_states.insert( i, new_state );
+      if ( verbose ) {
+        fprintf( stderr,
+                 "[%u] Received OUT-OF-ORDER state %d [ack %d]\n",
+                 (unsigned int)( timestamp() % 100000 ),
+                 (int)new_state.num,
+                 (int)inst.ack_num() );
       }
+      return;
     }
+    received_states.push_back( new_state );
     if ( verbose ) {
       fprintf( stderr,
-               "[%u] Received state %d [coming from %d, ack %d]\n",
+               "[%u] Received state %d [coming from %d, ack %d]; %d received states in %llu bytes; "
+               "%llu fragments rebuilt from parity\n",
                (unsigned int)( timestamp() % 100000 ),
                (int)new_state.num,
                (int)inst.old_num(),
-               (int)inst.ack_num() );
+               (int)inst.ack_num(),
+               (int)received_states.size(),
+               (unsigned long long)history_memory_usage( received_states ),
+               (unsigned long long)fragments.get_recovered() );
     }
-    received_states.push_back( new_state );
     sender.set_ack_num( received_states.back().num );
 
     sender.remote_heard( new_state.timestamp );
-    if ( !inst.diff().empty() ) {
+    if ( !inst.diff().empty() || ( inst.chaff().size() > CHAFF_MAX ) ) { /* ... or a path MTU probe */
       sender.set_data_ack();
     }
   }
@@ -178,15 +199,7 @@ void Transport<MyState, RemoteState>::recv( void )
 template<class MyState, class RemoteState>
 void Transport<MyState, RemoteState>::process_throwaway_until( uint64_t throwaway_num )
 {
-  typename std::list<TimestampedState<RemoteState>>::iterator i = received_states.begin();
-  while ( i != received_states.end() ) {
-    typename std::list<TimestampedState<RemoteState>>::iterator inext = i;
-    inext++;
-    if ( i->num < throwaway_num ) {
-      received_states.erase( i );
-    }
-    i = inext;
-  }
+  received_states.erase( received_states.begin(), lower_bound_num( received_states, throwaway_num ) );
 
   fatal_assert( received_states.size() > 0 );
 }
@@ -200,7 +213,7 @@ std::string Transport<MyState, RemoteState>::get_remote_diff( void )
 
   const RemoteState* oldest_receiver_state = &received_states.front().state;
 
-  for ( typename std::list<TimestampedState<RemoteState>>::reverse_iterator i = received_states.rbegin();
+  for ( typename received_states_type::reverse_iterator i = received_states.rbegin();
         i != received_states.rend();
         i++ ) {
     i->state.subtract( oldest_receiver_state );
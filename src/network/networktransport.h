@@ -35,7 +35,7 @@
 
 #include <csignal>
 #include <ctime>
-#include <list>
+#include <deque>
 #include <string>
 #include <vector>
 
@@ -44,6 +44,11 @@
 #include "transportfragment.h"
 
 namespace Network {
+/* The receiver keeps every state from the sender's throwaway_num on, so
+   whichever sent state the sender picks as a reference is still here.
+   This only bounds a sender that never lets go. */
+const size_t RECEIVED_STATES_MAX = 1024;
+
 template<class MyState, class RemoteState>
 class Transport
 {
@@ -55,14 +60,17 @@ private:
   TransportSender<MyState> sender;
 
   /* helper methods for recv() */
+  void process_datagram( const char* s, size_t len );
   void process_throwaway_until( uint64_t throwaway_num );
 
   /* simple receiver */
-  std::list<TimestampedState<RemoteState>> received_states;
+  using received_states_type = std::deque<TimestampedState<RemoteState>>;
+  received_states_type received_states; /* in order of num */
   uint64_t receiver_quench_timer;
   RemoteState last_receiver_state; /* the state we were in when user last queried state */
   FragmentAssembly fragments;
   unsigned int verbose;
+  uint32_t remote_capabilities; /* as last advertised by the other side */
 
 public:
   Transport( MyState& initial_state,
@@ -79,10 +87,12 @@ public:
   void tick( void ) { sender.tick(); }
 
   /* Returns the number of ms to wait until next possible event. */
-  int wait_time( void ) { return sender.wait_time(); }
+  int wait_time( void ) { return connection.has_queued_datagrams() ? 0 : sender.wait_time(); }
 
-  /* Blocks waiting for a packet. */
+  /* Processes every datagram waiting on the sockets.  If one of them
+     throws, the rest stay queued for the next call. */
   void recv( void );
+  bool has_queued_datagrams( void ) const { return connection.has_queued_datagrams(); }
 
   /* Find diff between last receiver state and current remote state, then rationalize states. */
   std::string get_remote_diff( void );
@@ -110,6 +120,10 @@ public:
 
   const std::vector<int> fds( void ) const { return connection.fds(); }
 
+  /* Multipath: another local address or interface to reach the server from */
+  void add_path( const std::string& local ) { connection.add_path( local ); }
+  const Connection& get_connection( void ) const { return connection; }
+
   void set_verbose( unsigned int s_verbose )
   {
     sender.set_verbose( s_verbose );
@@ -118,6 +132,10 @@ public:
 
   void set_send_delay( int new_delay ) { sender.set_send_delay( new_delay ); }
 
+  /* Optional features we advertise, and those the other side advertised */
+  void set_capabilities( uint32_t capabilities ) { sender.set_capabilities( capabilities ); }
+  uint32_t get_remote_capabilities( void ) const { return remote_capabilities; }
+
   uint64_t get_sent_state_acked_timestamp( void ) const { return sender.get_sent_state_acked_timestamp(); }
   uint64_t get_sent_state_acked( void ) const { return sender.get_sent_state_acked(); }
   uint64_t get_sent_state_last( void ) const { return sender.get_sent_state_last(); }
@@ -0,0 +1,121 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include <algorithm>
+
+#include "pathmtu.h"
+
+using namespace Network;
+
+PathMTU::PathMTU( int s_minimum, int s_base, int s_maximum )
+  : minimum( s_minimum ), base( s_base ), maximum( std::max( s_base, s_maximum ) ), current( s_base ),
+    too_big( maximum + 1 ), tries( 0 ), next_search( 0 )
+{}
+
+int PathMTU::probe_size( uint64_t now ) const
+{
+  if ( now < next_search ) {
+    return 0;
+  }
+
+  if ( too_big > maximum ) {
+    return maximum;
+  }
+
+  return current + ( too_big - current ) / 2;
+}
+
+/* The bounds have met: stop probing for a while, and start the next
+   search from the top, as the path may have grown. */
+void PathMTU::searched( uint64_t now )
+{
+  if ( ( current < maximum ) && ( too_big - current > PROBE_GRANULARITY ) ) {
+    return;
+  }
+
+  too_big = maximum + 1;
+  tries = 0;
+  next_search = now + PMTU_RAISE_TIMER;
+}
+
+void PathMTU::probe_acked( int size, uint64_t now )
+{
+  if ( size > current ) {
+    current = std::min( size, maximum );
+  }
+  tries = 0;
+  searched( now );
+}
+
+void PathMTU::probe_lost( int size, uint64_t now )
+{
+  if ( ( size <= current ) || ( size >= too_big ) ) {
+    return; /* already decided */
+  }
+
+  if ( ++tries >= MAX_PROBES ) {
+    too_big = size;
+    tries = 0;
+    searched( now );
+  }
+}
+
+void PathMTU::probe_too_big( int size, uint64_t now )
+{
+  if ( size < too_big ) {
+    too_big = std::max( size, current + 1 );
+  }
+  tries = 0;
+  searched( now );
+}
+
+void PathMTU::black_hole( uint64_t now )
+{
+  /* only what probing raised is suspect; the base size fragments
+     where it must, as it always did */
+  if ( current <= base ) {
+    return;
+  }
+
+  current = base;
+  too_big = maximum + 1;
+  tries = 0;
+  next_search = now + PMTU_RAISE_TIMER;
+}
+
+void PathMTU::refused( uint64_t now )
+{
+  current = std::min( current, minimum );
+  too_big = maximum + 1;
+  tries = 0;
+  next_search = now + PMTU_RAISE_TIMER;
+}
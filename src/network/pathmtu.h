@@ -0,0 +1,92 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#ifndef PATH_MTU_HPP
+#define PATH_MTU_HPP
+
+#include <cstdint>
+
+namespace Network {
+/* path MTU discovery parameters */
+const int PROBE_GRANULARITY = 16;         /* bytes; the search ends when the bounds are this close */
+const int MAX_PROBES = 3;                 /* tries of a size before taking it to be too big */
+const uint64_t PMTU_RAISE_TIMER = 600000; /* ms from the end of one search to the next */
+
+/* Packetization-layer path MTU discovery (RFC 4821, RFC 8899) for one
+   path, without ICMP.  Sizes are of the UDP payload, as the
+   Connection's MTU is.
+
+   The path starts out at the base size, which the old fixed MTU has
+   shown to be safe.  Probes, padded to the size under test and sent
+   with the don't-fragment bit, search the range up to the maximum:
+   first the maximum itself, which a clean wired path carries, then by
+   halving.  A probe that is acknowledged raises the MTU; one that
+   goes unacknowledged MAX_PROBES times caps the search.  Once the
+   bounds meet, nothing is probed until PMTU_RAISE_TIMER has passed.
+
+   If instructions that fill datagrams stop getting through after the
+   MTU was raised, the path has changed under us and the MTU returns to
+   the base size. */
+class PathMTU
+{
+private:
+  int minimum; /* of last resort, after the base size was refused */
+  int base;
+  int maximum;
+  int current;         /* confirmed */
+  int too_big;         /* least size taken to fail, or maximum + 1 */
+  int tries;           /* at the size probe_size() gives */
+  uint64_t next_search; /* ms when probing may resume */
+
+  void searched( uint64_t now );
+
+public:
+  PathMTU( int s_minimum, int s_base, int s_maximum );
+
+  int get( void ) const { return current; }
+  /* the size to probe next, or 0 if there is nothing to probe now */
+  int probe_size( uint64_t now ) const;
+
+  void probe_acked( int size, uint64_t now );
+  void probe_lost( int size, uint64_t now );
+  /* the local interface refused it */
+  void probe_too_big( int size, uint64_t now );
+
+  /* full-sized datagrams are not getting through */
+  void black_hole( uint64_t now );
+
+  /* a datagram of the current size was refused outright */
+  void refused( uint64_t now );
+};
+}
+
+#endif
@@ -30,92 +30,109 @@
     also delete it here.
 */
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 
 #include "compressor.h"
 #include "src/crypto/byteorder.h"
+#include "src/network/network.h"
 #include "src/protobufs/transportinstruction.pb.h"
+#include "src/util/dos_assert.h"
 #include "src/util/fatal_assert.h"
 #include "transportfragment.h"
 
 using namespace Network;
 using namespace TransportBuffers;
 
-static std::string network_order_string( uint16_t host_order )
-{
-  uint16_t net_int = htobe16( host_order );
-  return std::string( (char*)&net_int, sizeof( net_int ) );
-}
-
-static std::string network_order_string( uint64_t host_order )
-{
-  uint64_t net_int = htobe64( host_order );
-  return std::string( (char*)&net_int, sizeof( net_int ) );
-}
-
 std::string Fragment::tostring( void )
 {
   assert( initialized );
 
-  std::string ret;
-
-  ret += network_order_string( id );
-
-  fatal_assert(
-    !( fragment_num & 0x8000 ) ); /* effective limit on size of a terminal screen change or buffered user input */
-  uint16_t combined_fragment_num = ( final << 15 ) | fragment_num;
-  ret += network_order_string( combined_fragment_num );
+  char header[frag_header_len];
+  FragmentView( id, fragment_num, final, contents.data(), contents.size(), parity ).write_header( header );
 
-  assert( ret.size() == frag_header_len );
+  return std::string( header, frag_header_len ) + contents;
+}
 
-  ret += contents;
+void FragmentView::write_header( char* buf ) const
+{
+  uint64_t net_id = htobe64( id );
+  memcpy( buf, &net_id, sizeof( net_id ) );
 
-  return ret;
+  /* effective limit on size of a terminal screen change or buffered user input */
+  fatal_assert( !( fragment_num & ( 0x8000 | PARITY_FLAG ) ) );
+  uint16_t net_fragment_num = htobe16( ( final << 15 ) | ( parity ? PARITY_FLAG : 0 ) | fragment_num );
+  memcpy( buf + sizeof( net_id ), &net_fragment_num, sizeof( net_fragment_num ) );
 }
 
 Fragment::Fragment( const std::string& x )
-  : id( -1 ), fragment_num( -1 ), final( false ), initialized( true ), contents()
+  : id( -1 ), fragment_num( -1 ), final( false ), parity( false ), initialized( true ), contents()
 {
-  fatal_assert( x.size() >= frag_header_len );
-  contents = std::string( x.begin() + frag_header_len, x.end() );
+  const FragmentView view( x.data(), x.size() );
+  id = view.id;
+  fragment_num = view.fragment_num;
+  final = view.final;
+  parity = view.parity;
+  contents.assign( view.data, view.len );
+}
+
+FragmentView::FragmentView( const char* buf, size_t buf_len )
+  : id( -1 ), fragment_num( -1 ), final( false ), parity( false ), data( buf + Fragment::frag_header_len ),
+    len( buf_len - Fragment::frag_header_len )
+{
+  fatal_assert( buf_len >= Fragment::frag_header_len );
 
   uint64_t data64;
-  uint16_t* data16 = (uint16_t*)x.data();
-  memcpy( &data64, x.data(), sizeof( data64 ) );
+  uint16_t data16;
+  memcpy( &data64, buf, sizeof( data64 ) );
+  memcpy( &data16, buf + sizeof( data64 ), sizeof( data16 ) );
   id = be64toh( data64 );
-  fragment_num = be16toh( data16[4] );
+  fragment_num = be16toh( data16 );
   final = ( fragment_num & 0x8000 ) >> 15;
-  fragment_num &= 0x7FFF;
+  parity = fragment_num & PARITY_FLAG;
+  fragment_num &= ~( 0x8000 | PARITY_FLAG );
+  fatal_assert( !parity || ( len >= PARITY_HEADER_LEN ) );
+}
+
+static uint16_t read16( const char* buf )
+{
+  uint16_t net;
+  memcpy( &net, buf, sizeof( net ) );
+  return be16toh( net );
+}
+
+static void write16( char* buf, uint16_t x )
+{
+  uint16_t net = htobe16( x );
+  memcpy( buf, &net, sizeof( net ) );
 }
 
-bool FragmentAssembly::add_fragment( Fragment& frag )
+bool FragmentAssembly::add_fragment( const FragmentView& frag )
 {
   /* see if this is a totally new packet */
   if ( current_id != frag.id ) {
     fragments.clear();
-    fragments.resize( frag.fragment_num + 1 );
-    fragments.at( frag.fragment_num ) = frag;
-    fragments_arrived = 1;
+    parities.clear();
+    fragments_arrived = 0;
     fragments_total = -1; /* unknown */
     current_id = frag.id;
-  } else { /* not a new packet */
-    /* see if we already have this fragment */
-    if ( ( fragments.size() > frag.fragment_num ) && ( fragments.at( frag.fragment_num ).initialized ) ) {
-      /* make sure new version is same as what we already have */
-      assert( fragments.at( frag.fragment_num ) == frag );
-    } else {
-      if ( (int)fragments.size() < frag.fragment_num + 1 ) {
-        fragments.resize( frag.fragment_num + 1 );
-      }
-      fragments.at( frag.fragment_num ) = frag;
-      fragments_arrived++;
-    }
   }
 
-  if ( frag.final ) {
-    fragments_total = frag.fragment_num + 1;
-    assert( (int)fragments.size() <= fragments_total );
-    fragments.resize( fragments_total );
+  dos_assert( frag.len <= SLOT_LEN );
+  if ( frag.parity ) {
+    add_parity( frag );
+  } else {
+    add_data( frag );
+  }
+
+  /* each rebuilt fragment may leave another parity fragment one short */
+  bool progress = true;
+  while ( progress && ( fragments_arrived != fragments_total ) ) {
+    progress = false;
+    for ( size_t i = 0; i < parities.size(); i++ ) {
+      progress |= recover( i );
+    }
   }
 
   if ( fragments_total != -1 ) {
@@ -126,41 +143,173 @@ bool FragmentAssembly::add_fragment( Fragment& frag )
   return fragments_arrived == fragments_total;
 }
 
-Instruction FragmentAssembly::get_assembly( void )
+/* room for fragment numbers below count; storage only ever grows */
+void FragmentAssembly::resize( size_t count )
 {
-  assert( fragments_arrived == fragments_total );
+  fragments.resize( count, Slot() );
+  if ( storage.size() < count * SLOT_LEN ) {
+    storage.resize( count * SLOT_LEN );
+  }
+}
 
-  std::string encoded;
+void FragmentAssembly::add_data( const FragmentView& frag )
+{
+  /* see if we already have this fragment */
+  if ( ( fragments.size() > frag.fragment_num ) && ( fragments.at( frag.fragment_num ).initialized ) ) {
+    /* make sure new version is same as what we already have */
+    assert( ( fragments.at( frag.fragment_num ).final == frag.final )
+            && ( fragments.at( frag.fragment_num ).len == frag.len )
+            && ( memcmp( contents( frag.fragment_num ), frag.data, frag.len ) == 0 ) );
+  } else {
+    if ( fragments.size() < size_t( frag.fragment_num ) + 1 ) {
+      resize( frag.fragment_num + 1 );
+    }
+    memcpy( contents( frag.fragment_num ), frag.data, frag.len );
+    arrived( frag.fragment_num, frag.final, frag.len );
+  }
+}
 
-  for ( int i = 0; i < fragments_total; i++ ) {
-    assert( fragments.at( i ).initialized );
-    encoded += fragments.at( i ).contents;
+void FragmentAssembly::arrived( size_t fragment_num, bool final, size_t len )
+{
+  Slot& slot = fragments.at( fragment_num );
+  slot.fragment_num = fragment_num;
+  slot.initialized = true;
+  slot.final = final;
+  slot.len = len;
+  fragments_arrived++;
+
+  if ( final ) {
+    set_total( fragment_num + 1 );
   }
+}
 
-  Instruction ret;
-  fatal_assert( ret.ParseFromString( get_compressor().uncompress_str( encoded ) ) );
+void FragmentAssembly::add_parity( const FragmentView& frag )
+{
+  for ( size_t i = 0; i < parities.size(); i++ ) {
+    if ( parities[i].fragment_num == frag.fragment_num ) {
+      assert( ( parities[i].final == frag.final ) && ( parities[i].len == frag.len )
+              && ( memcmp( parity_contents( i ), frag.data, frag.len ) == 0 ) );
+      return;
+    }
+  }
+
+  Slot slot;
+  slot.fragment_num = frag.fragment_num;
+  slot.initialized = true;
+  slot.final = frag.final;
+  slot.len = frag.len;
+  parities.push_back( slot );
+  if ( parity_storage.size() < parities.size() * SLOT_LEN ) {
+    parity_storage.resize( parities.size() * SLOT_LEN );
+  }
+  memcpy( parity_contents( parities.size() - 1 ), frag.data, frag.len );
+
+  if ( frag.final ) {
+    set_total( frag.fragment_num + read16( frag.data ) );
+  }
+}
+
+void FragmentAssembly::set_total( int total )
+{
+  fragments_total = total;
+  assert( (int)fragments.size() <= fragments_total );
+  resize( fragments_total );
+}
+
+/* Rebuild, in its slot, the one data fragment the i'th parity fragment
+   covers that is missing, if exactly one is.  Returns whether it did. */
+bool FragmentAssembly::recover( size_t i )
+{
+  const Slot& parity = parities.at( i );
+  const char* parity_data = parity_contents( i );
+  const size_t first = parity.fragment_num;
+  const size_t count = read16( parity_data );
+
+  size_t missing = -1;
+  for ( size_t j = first; j < first + count; j++ ) {
+    if ( ( j >= fragments.size() ) || !fragments.at( j ).initialized ) {
+      if ( missing != size_t( -1 ) ) {
+        return false; /* too many to rebuild (yet) */
+      }
+      missing = j;
+    }
+  }
+  if ( missing == size_t( -1 ) ) {
+    return false; /* nothing to do */
+  }
+
+  if ( fragments.size() < missing + 1 ) {
+    resize( missing + 1 );
+  }
+
+  size_t len = read16( parity_data + sizeof( uint16_t ) );
+  const size_t padded = parity.len - PARITY_HEADER_LEN;
+  char* rebuilt = contents( missing );
+  memcpy( rebuilt, parity_data + PARITY_HEADER_LEN, padded );
+  for ( size_t j = first; j < first + count; j++ ) {
+    if ( j != missing ) {
+      const Slot& other = fragments.at( j );
+      const char* other_data = contents( j );
+      fatal_assert( other.len <= padded );
+      len ^= other.len;
+      for ( size_t k = 0; k < other.len; k++ ) {
+        rebuilt[k] ^= other_data[k];
+      }
+    }
+  }
+  fatal_assert( len <= padded );
+
+  arrived( missing, parity.final && ( missing == first + count - 1 ), len );
+  recovered++;
+  return true;
+}
+
+const Instruction& FragmentAssembly::get_assembly( void )
+{
+  assert( fragments_arrived == fragments_total );
+  dos_assert( fragments_total > 0 );
+
+  /* most instructions fit one fragment, and need no copy */
+  const char* payload = contents( 0 );
+  size_t payload_len = fragments.at( 0 ).len;
+  if ( fragments_total > 1 ) {
+    encoded.clear();
+    for ( int i = 0; i < fragments_total; i++ ) {
+      assert( fragments.at( i ).initialized );
+      encoded.append( contents( i ), fragments.at( i ).len );
+    }
+    payload = encoded.data();
+    payload_len = encoded.size();
+  }
+
+  size_t len;
+  const char* decoded = get_compressor().uncompress( payload, payload_len, &len );
+  fatal_assert( instruction.ParseFromArray( decoded, len ) );
 
   fragments.clear();
+  parities.clear();
   fragments_arrived = 0;
   fragments_total = -1;
 
-  return ret;
+  return instruction;
 }
 
 bool Fragment::operator==( const Fragment& x ) const
 {
-  return ( id == x.id ) && ( fragment_num == x.fragment_num ) && ( final == x.final )
+  return ( id == x.id ) && ( fragment_num == x.fragment_num ) && ( final == x.final ) && ( parity == x.parity )
          && ( initialized == x.initialized ) && ( contents == x.contents );
 }
 
-std::vector<Fragment> Fragmenter::make_fragments( const Instruction& inst, size_t MTU )
+std::vector<FragmentView> Fragmenter::make_fragments( const Instruction& inst, size_t MTU )
 {
   MTU -= Fragment::frag_header_len;
   if ( ( inst.old_num() != last_instruction.old_num() ) || ( inst.new_num() != last_instruction.new_num() )
        || ( inst.ack_num() != last_instruction.ack_num() )
        || ( inst.throwaway_num() != last_instruction.throwaway_num() )
-       || ( inst.chaff() != last_instruction.chaff() )
-       || ( inst.protocol_version() != last_instruction.protocol_version() ) || ( last_MTU != MTU ) ) {
+       || ( inst.chaff() != last_instruction.chaff() ) || ( inst.ecn_ect() != last_instruction.ecn_ect() )
+       || ( inst.ecn_ce() != last_instruction.ecn_ce() )
+       || ( inst.protocol_version() != last_instruction.protocol_version() ) || ( last_MTU != MTU )
+       || ( last_remote_capabilities != remote_capabilities ) || ( last_parity_group != parity_group ) ) {
     next_instruction_id++;
   }
 
@@ -170,25 +319,53 @@ std::vector<Fragment> Fragmenter::make_fragments( const Instruction& inst, size_
 
   last_instruction = inst;
   last_MTU = MTU;
+  last_remote_capabilities = remote_capabilities;
+  last_parity_group = parity_group;
+
+  payload = get_compressor().compress_str( inst.SerializeAsString(), remote_capabilities );
+
+  /* parity fragments carry a header, so data fragments leave room for it */
+  size_t group = 0;
+  if ( ( parity_group > 0 ) && ( remote_capabilities & CAPABILITY_PARITY ) && ( payload.size() > MTU ) ) {
+    MTU -= PARITY_HEADER_LEN;
+    group = parity_group;
+  }
+
+  const size_t data_count = ( payload.size() + MTU - 1 ) / MTU;
+  const size_t parity_count = group ? ( data_count + group - 1 ) / group : 0;
+  std::vector<FragmentView> ret;
+  ret.reserve( data_count + parity_count );
+
+  /* FragmentViews point into parity, so it must not reallocate */
+  parity.assign( parity_count * ( PARITY_HEADER_LEN + MTU ), 0 );
+  char* parity_fragment = &parity[0];
 
-  std::string payload = get_compressor().compress_str( inst.SerializeAsString() );
   uint16_t fragment_num = 0;
-  std::vector<Fragment> ret;
-
-  while ( !payload.empty() ) {
-    std::string this_fragment;
-    bool final = false;
-
-    if ( payload.size() > MTU ) {
-      this_fragment = std::string( payload.begin(), payload.begin() + MTU );
-      payload = std::string( payload.begin() + MTU, payload.end() );
-    } else {
-      this_fragment = payload;
-      payload.clear();
-      final = true;
+  uint16_t lengths = 0; /* XOR of the lengths in the current group */
+  for ( size_t offset = 0; offset < payload.size(); offset += MTU ) {
+    const size_t len = std::min( MTU, payload.size() - offset );
+    const bool final = ( offset + len == payload.size() );
+    ret.push_back( FragmentView( next_instruction_id, fragment_num++, final, payload.data() + offset, len ) );
+
+    if ( !group ) {
+      continue;
     }
 
-    ret.push_back( Fragment( next_instruction_id, fragment_num++, final, this_fragment ) );
+    /* fold this fragment into its group's parity, and send that after the group */
+    const size_t first = fragment_num - 1 - ( fragment_num - 1 ) % group;
+    const size_t count = fragment_num - first;
+    lengths ^= len;
+    for ( size_t i = 0; i < len; i++ ) {
+      parity_fragment[PARITY_HEADER_LEN + i] ^= payload[offset + i];
+    }
+    if ( ( count == group ) || final ) {
+      write16( parity_fragment, count );
+      write16( parity_fragment + sizeof( uint16_t ), lengths );
+      lengths = 0;
+      ret.push_back( FragmentView(
+        next_instruction_id, first, final, parity_fragment, PARITY_HEADER_LEN + ( count > 1 ? MTU : len ), true ) );
+      parity_fragment += PARITY_HEADER_LEN + MTU;
+    }
   }
 
   return ret;
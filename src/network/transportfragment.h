@@ -42,6 +42,16 @@
 namespace Network {
 using namespace TransportBuffers;
 
+/* A parity fragment (sent only to peers with CAPABILITY_PARITY) has
+   the parity bit set in its fragment number, which is otherwise that of
+   the first data fragment it covers.  Its contents are the number of
+   data fragments covered and the XOR of their lengths (16 bits each,
+   network byte order), then the XOR of their contents, zero-padded to
+   the longest.  It can rebuild any one of them that is lost.  Its final
+   flag says the last fragment it covers is the final one. */
+static const uint16_t PARITY_FLAG = 0x4000;
+static const size_t PARITY_HEADER_LEN = 2 * sizeof( uint16_t );
+
 class Fragment
 {
 public:
@@ -50,15 +60,21 @@ public:
   uint64_t id;
   uint16_t fragment_num;
   bool final;
+  bool parity;
 
   bool initialized;
 
   std::string contents;
 
-  Fragment() : id( -1 ), fragment_num( -1 ), final( false ), initialized( false ), contents() {}
+  Fragment() : id( -1 ), fragment_num( -1 ), final( false ), parity( false ), initialized( false ), contents() {}
 
-  Fragment( uint64_t s_id, uint16_t s_fragment_num, bool s_final, const std::string& s_contents )
-    : id( s_id ), fragment_num( s_fragment_num ), final( s_final ), initialized( true ), contents( s_contents )
+  Fragment( uint64_t s_id,
+            uint16_t s_fragment_num,
+            bool s_final,
+            const std::string& s_contents,
+            bool s_parity = false )
+    : id( s_id ), fragment_num( s_fragment_num ), final( s_final ), parity( s_parity ), initialized( true ),
+      contents( s_contents )
   {}
 
   Fragment( const std::string& x );
@@ -68,17 +84,83 @@ public:
   bool operator==( const Fragment& x ) const;
 };
 
+/* A fragment whose contents live elsewhere: for an outgoing one, in
+   the Fragmenter's payload until the next call to make_fragments(); for
+   an incoming one, in the datagram it was received in */
+class FragmentView
+{
+public:
+  uint64_t id;
+  uint16_t fragment_num;
+  bool final;
+  bool parity;
+
+  const char* data;
+  size_t len;
+
+  FragmentView( uint64_t s_id,
+                uint16_t s_fragment_num,
+                bool s_final,
+                const char* s_data,
+                size_t s_len,
+                bool s_parity = false )
+    : id( s_id ), fragment_num( s_fragment_num ), final( s_final ), parity( s_parity ), data( s_data ), len( s_len )
+  {}
+
+  /* parses a received fragment, header and all */
+  FragmentView( const char* buf, size_t buf_len );
+
+  /* writes Fragment::frag_header_len bytes */
+  void write_header( char* buf ) const;
+};
+
+/* Incoming fragments are copied once, into slots of storage that (like
+   the vectors) keep their capacity from one instruction to the next, so
+   reassembly allocates nothing in the steady state. */
 class FragmentAssembly
 {
 private:
-  std::vector<Fragment> fragments;
+  static const size_t SLOT_LEN = Session::RECEIVE_MTU; /* bounds a fragment's contents */
+
+  struct Slot
+  {
+    uint16_t fragment_num; /* parity slots are kept in arrival order */
+    bool initialized;
+    bool final;
+    size_t len;
+  };
+
+  std::vector<Slot> fragments; /* by fragment number */
+  std::vector<Slot> parities;
+  std::string storage;        /* contents of fragments[i] at i * SLOT_LEN */
+  std::string parity_storage; /* ... and of parities[i] */
+  std::string encoded;        /* reassembled payload */
+  Instruction instruction;
   uint64_t current_id;
   int fragments_arrived, fragments_total;
+  uint64_t recovered;
+
+  char* contents( size_t i ) { return &storage[i * SLOT_LEN]; }
+  char* parity_contents( size_t i ) { return &parity_storage[i * SLOT_LEN]; }
+
+  void resize( size_t count );
+  void add_data( const FragmentView& frag );
+  void add_parity( const FragmentView& frag );
+  void arrived( size_t fragment_num, bool final, size_t len );
+  void set_total( int total );
+  bool recover( size_t parity );
 
 public:
-  FragmentAssembly() : fragments(), current_id( -1 ), fragments_arrived( 0 ), fragments_total( -1 ) {}
-  bool add_fragment( Fragment& inst );
-  Instruction get_assembly( void );
+  FragmentAssembly()
+    : fragments(), parities(), storage(), parity_storage(), encoded(), instruction(), current_id( -1 ),
+      fragments_arrived( 0 ), fragments_total( -1 ), recovered( 0 )
+  {}
+  bool add_fragment( const FragmentView& frag );
+  /* valid until the next get_assembly() */
+  const Instruction& get_assembly( void );
+
+  /* data fragments rebuilt from parity, for --verbose */
+  uint64_t get_recovered( void ) const { return recovered; }
 };
 
 class Fragmenter
@@ -87,15 +169,26 @@ private:
   uint64_t next_instruction_id;
   Instruction last_instruction;
   size_t last_MTU;
+  uint32_t remote_capabilities, last_remote_capabilities; /* choose the compression format */
+  size_t parity_group, last_parity_group; /* data fragments per parity fragment, or 0 */
+  std::string payload; /* compressed instruction that the FragmentViews point into */
+  std::string parity;  /* parity fragments, likewise */
 
 public:
-  Fragmenter() : next_instruction_id( 0 ), last_instruction(), last_MTU( -1 )
+  Fragmenter()
+    : next_instruction_id( 0 ), last_instruction(), last_MTU( -1 ), remote_capabilities( 0 ),
+      last_remote_capabilities( 0 ), parity_group( 0 ), last_parity_group( 0 ), payload(), parity()
   {
     last_instruction.set_old_num( -1 );
     last_instruction.set_new_num( -1 );
   }
-  std::vector<Fragment> make_fragments( const Instruction& inst, size_t MTU );
+  std::vector<FragmentView> make_fragments( const Instruction& inst, size_t MTU );
   uint64_t last_ack_sent( void ) const { return last_instruction.ack_num(); }
+  const Instruction& get_last_instruction( void ) const { return last_instruction; }
+  void set_remote_capabilities( uint32_t s_remote ) { remote_capabilities = s_remote; }
+  /* used only if the peer has CAPABILITY_PARITY and the instruction
+     needs more than one fragment */
+  void set_parity_group( size_t s_parity_group ) { parity_group = s_parity_group; }
 };
 
 }
@@ -34,11 +34,12 @@
 #define TRANSPORT_SENDER_IMPL_HPP
 
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
-#include <list>
+#include <deque>
 
 #include "src/network/transportfragment.h"
 #include "src/network/transportsender.h"
@@ -53,14 +54,28 @@ TransportSender<MyState>::TransportSender( Connection* s_connection, MyState& in
     assumed_receiver_state( sent_states.begin() ), fragmenter(), next_ack_time( timestamp() ),
     next_send_time( timestamp() ), verbose( 0 ), shutdown_in_progress( false ), shutdown_tries( 0 ),
     shutdown_start( -1 ), ack_num( 0 ), pending_data_ack( false ), SEND_MINDELAY( 8 ), last_heard( 0 ), prng(),
-    mindelay_clock( -1 )
+    mindelay_clock( -1 ), capabilities( TRANSPORT_CAPABILITIES | get_compressor().capabilities() ),
+    remote_capabilities( 0 ), diff_cache(), diff_cache_gen( 0 ),
+    diff_cache_hits( 0 ), diff_cache_misses( 0 ), diff_cache_saved( 0 ), delivery_ratio( 1.0 ),
+    last_delivered_num( 0 ), last_overdue_num( 0 ), last_loss_sent( 0 ), references_acked( 0 ), references_newest( 0 ),
+    references_intermediate( 0 ), congestion(), last_RTT_samples( 0 ), unacked_bytes(), last_frame_bytes( 0 ),
+    probe_pending( false ), probe_num( -1 ), probe_size( 0 ), probe_sent( 0 ), full_size_sends( 0 ),
+    full_size_since( 0 ), paced(), paced_next( 0 ), pace_clock( 0 )
 {}
 
-/* Try to send roughly two frames per RTT, bounded by limits on frame rate */
+/* Try to send roughly two frames per RTT, bounded by limits on frame rate.
+   When frames are large compared to the congestion window, send them
+   less often: each diff then covers more changes, for fewer bytes.
+   The frame rate also falls in proportion to the ECN-marked fraction. */
 template<class MyState>
 unsigned int TransportSender<MyState>::send_interval( void ) const
 {
   int SEND_INTERVAL = lrint( ceil( connection->get_SRTT() / 2.0 ) );
+  if ( congestion.measured() ) {
+    SEND_INTERVAL = std::max(
+      SEND_INTERVAL, int( lrint( ceil( connection->get_SRTT() * last_frame_bytes / congestion.get_window() ) ) ) );
+    SEND_INTERVAL = lrint( ceil( SEND_INTERVAL * ( 1 + congestion.get_ecn_alpha() ) ) );
+  }
   if ( SEND_INTERVAL < SEND_INTERVAL_MIN ) {
     SEND_INTERVAL = SEND_INTERVAL_MIN;
   } else if ( SEND_INTERVAL > SEND_INTERVAL_MAX ) {
@@ -103,6 +118,12 @@ void TransportSender<MyState>::calculate_timers( void )
     next_send_time = uint64_t( -1 );
   }
 
+  /* probe the path MTU between frames, not only once the session is idle */
+  if ( !probe_pending && !shutdown_in_progress && ( current_state == assumed_receiver_state->state )
+       && ( connection->get_MTU_probe() > 0 ) ) {
+    next_ack_time = std::min( next_ack_time, probe_sent + PROBE_INTERVAL );
+  }
+
   /* speed up shutdown sequence */
   if ( shutdown_in_progress || ( ack_num == uint64_t( -1 ) ) ) {
     next_ack_time = sent_states.back().timestamp + send_interval();
@@ -120,6 +141,10 @@ int TransportSender<MyState>::wait_time( void )
     next_wakeup = next_send_time;
   }
 
+  if ( paced_next < paced.size() ) {
+    next_wakeup = std::min( next_wakeup, uint64_t( ceil( pace_clock ) ) );
+  }
+
   uint64_t now = timestamp();
 
   if ( !connection->get_has_remote_addr() ) {
@@ -143,6 +168,29 @@ void TransportSender<MyState>::tick( void )
     return;
   }
 
+  /* a probe is only lost if the receiver was heard from meanwhile */
+  if ( probe_pending && ( timestamp() - probe_sent > PROBE_TIMEOUT + connection->timeout() ) ) {
+    probe_pending = false;
+    if ( last_heard > probe_sent ) {
+      connection->MTU_probe_lost( probe_size );
+    }
+    if ( verbose ) {
+      fprintf( stderr,
+               "[%u] Path MTU probe of %d bytes lost, MTU %d\n",
+               (unsigned int)( timestamp() % 100000 ),
+               probe_size,
+               connection->get_MTU() );
+    }
+  }
+
+  /* finish pacing out the last instruction before making another */
+  if ( paced_next < paced.size() ) {
+    send_paced();
+    if ( paced_next < paced.size() ) {
+      return;
+    }
+  }
+
   uint64_t now = timestamp();
 
   if ( ( now < next_ack_time ) && ( now < next_send_time ) ) {
@@ -151,9 +199,9 @@ void TransportSender<MyState>::tick( void )
 
   /* Determine if a new diff or empty ack needs to be sent */
 
-  std::string diff = current_state.diff_from( assumed_receiver_state->state );
+  choose_reference_state();
 
-  attempt_prospective_resend_optimization( diff );
+  std::string diff = diff_from_sent_state( *assumed_receiver_state );
 
   if ( verbose ) {
     /* verify diff has round-trip identity (modulo Unicode fallback rendering) */
@@ -162,6 +210,12 @@ void TransportSender<MyState>::tick( void )
     if ( current_state.compare( newstate ) ) {
       fprintf( stderr, "Warning, round-trip Instruction verification failed!\n" );
     }
+    /* Verify the receiver's fast path agrees with its general parser. */
+    MyState general_state( assumed_receiver_state->state );
+    general_state.apply_string( diff, true );
+    if ( general_state.compare( newstate ) ) {
+      fprintf( stderr, "Warning, fast-path Instruction verification failed!\n" );
+    }
     /* Also verify that both the original frame and generated frame have the same initial diff. */
     std::string current_diff( current_state.init_diff() );
     std::string new_diff( newstate.init_diff() );
@@ -176,14 +230,20 @@ void TransportSender<MyState>::tick( void )
       mindelay_clock = uint64_t( -1 );
     }
     if ( ( now >= next_send_time ) ) {
+      /* nothing to resend yet, so look again after the minimum delay, not at once */
       next_send_time = uint64_t( -1 );
-      mindelay_clock = uint64_t( -1 );
+      mindelay_clock = now;
     }
   } else if ( ( now >= next_send_time ) || ( now >= next_ack_time ) ) {
     /* Send diffs or ack */
     send_to_receiver( diff );
     mindelay_clock = uint64_t( -1 );
   }
+
+  /* a probe that was due had its turn, sent or not */
+  if ( !probe_pending && ( now >= probe_sent + PROBE_INTERVAL ) ) {
+    probe_sent = now;
+  }
 }
 
 template<class MyState>
@@ -202,7 +262,9 @@ void TransportSender<MyState>::send_empty_ack( void )
 
   //  sent_states.push_back( TimestampedState<MyState>( sent_states.back().timestamp, new_num, current_state ) );
   add_sent_state( now, new_num, current_state );
-  send_in_fragments( "", new_num );
+  /* a prompt ack is no probe, which might be lost */
+  const bool probe = !( shutdown_in_progress || probe_pending || pending_data_ack );
+  send_in_fragments( "", new_num, probe ? connection->get_MTU_probe() : 0 );
 
   next_ack_time = now + ACK_INTERVAL;
   next_send_time = uint64_t( -1 );
@@ -211,16 +273,50 @@ void TransportSender<MyState>::send_empty_ack( void )
 template<class MyState>
 void TransportSender<MyState>::add_sent_state( uint64_t the_timestamp, uint64_t num, MyState& state )
 {
+  const uint64_t assumed_num = assumed_receiver_state->num;
+
   sent_states.push_back( TimestampedState<MyState>( the_timestamp, num, state ) );
-  if ( sent_states.size() > 32 ) { /* limit on state queue */
-    typename sent_states_type::iterator last = sent_states.end();
-    for ( int i = 0; i < 16; i++ ) {
-      last--;
-    }
-    sent_states.erase( last ); /* erase state from middle of queue */
+  if ( sent_states.size() > SENT_STATES_MAX ) {
+    sent_states.erase( sent_states.end() - SENT_STATES_NEWEST ); /* erase state from middle of queue */
+  }
+
+  /* Growing the queue moved it.  Should the assumed receiver state
+     have been culled, fall back to the known one. */
+  assumed_receiver_state = lower_bound_num( sent_states, assumed_num );
+  if ( assumed_receiver_state->num != assumed_num ) {
+    assumed_receiver_state = sent_states.begin();
   }
 }
 
+template<class MyState>
+std::string TransportSender<MyState>::diff_from_sent_state( const TimestampedState<MyState>& source )
+{
+  if ( diff_cache_gen != current_state.get_gen() ) {
+    diff_cache.clear();
+    diff_cache_gen = current_state.get_gen();
+  }
+
+  typename diff_cache_type::const_iterator i = diff_cache.find( source.num );
+  if ( i != diff_cache.end() ) {
+    diff_cache_hits++;
+    diff_cache_saved += i->second.cost;
+    return i->second.diff;
+  }
+
+  const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  std::string diff = current_state.diff_from( source.state );
+  const uint64_t cost
+    = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count();
+  diff_cache_misses++;
+
+  if ( diff_cache.size() >= DIFF_CACHE_MAX ) { /* e.g. a long run of empty acks */
+    diff_cache.clear();
+  }
+  diff_cache.insert( typename diff_cache_type::value_type( source.num, CachedDiff( diff, cost ) ) );
+
+  return diff;
+}
+
 template<class MyState>
 void TransportSender<MyState>::send_to_receiver( const std::string& diff )
 {
@@ -250,6 +346,56 @@ void TransportSender<MyState>::send_to_receiver( const std::string& diff )
   assumed_receiver_state--;
   next_ack_time = timestamp() + ACK_INTERVAL;
   next_send_time = uint64_t( -1 );
+
+  if ( verbose ) {
+    std::unordered_set<const void*> seen;
+    const size_t current_bytes = current_state.memory_usage( seen );
+    const size_t history_bytes = history_memory_usage( sent_states, seen ); /* beyond the current state */
+    fprintf( stderr,
+             "[%u] Diff cache: %llu hits, %llu misses, %.1f ms saved; "
+             "references: %llu acked, %llu newest, %llu intermediate; delivery ratio %.2f; "
+             "current state %llu bytes, plus %llu per sent state (%d retained)\n",
+             (unsigned int)( timestamp() % 100000 ),
+             (unsigned long long)diff_cache_hits,
+             (unsigned long long)diff_cache_misses,
+             diff_cache_saved / 1000.0,
+             (unsigned long long)references_acked,
+             (unsigned long long)references_newest,
+             (unsigned long long)references_intermediate,
+             delivery_ratio,
+             (unsigned long long)current_bytes,
+             (unsigned long long)( history_bytes / sent_states.size() ),
+             (int)sent_states.size() );
+
+    const Compressor::Counters& stored = get_compressor().get_counters();
+    fprintf( stderr,
+             "[%u] Stored payloads: sent %llu of %llu (%llu small, skipping %llu bytes of compression; "
+             "%llu incompressible, saving %llu bytes), received %llu of %llu (skipping uncompression)\n",
+             (unsigned int)( timestamp() % 100000 ),
+             (unsigned long long)( stored.sent_stored_small + stored.sent_stored_incompressible ),
+             (unsigned long long)stored.sent,
+             (unsigned long long)stored.sent_stored_small,
+             (unsigned long long)stored.sent_stored_small_bytes,
+             (unsigned long long)stored.sent_stored_incompressible,
+             (unsigned long long)stored.stored_bytes_saved,
+             (unsigned long long)stored.received_stored,
+             (unsigned long long)stored.received );
+
+    fprintf( stderr,
+             "[%u] Congestion: window %.0f bytes, base RTT %.1f ms, queueing delay %.1f ms, "
+             "pacing %.1f bytes/ms, last frame %llu bytes, frame interval %u ms; "
+             "ECN alpha %.3f, received %llu ECT and %llu CE\n",
+             (unsigned int)( timestamp() % 100000 ),
+             congestion.get_window(),
+             congestion.base_delay(),
+             congestion.queueing_delay(),
+             congestion.pacing_rate( connection->get_SRTT() ),
+             (unsigned long long)last_frame_bytes,
+             send_interval(),
+             congestion.get_ecn_alpha(),
+             (unsigned long long)connection->get_ecn_ect_received(),
+             (unsigned long long)connection->get_ecn_ce_received() );
+  }
 }
 
 template<class MyState>
@@ -261,7 +407,7 @@ void TransportSender<MyState>::update_assumed_receiver_state( void )
      transmitted recently enough ago */
   assumed_receiver_state = sent_states.begin();
 
-  typename std::list<TimestampedState<MyState>>::iterator i = sent_states.begin();
+  typename sent_states_type::iterator i = sent_states.begin();
   i++;
 
   while ( i != sent_states.end() ) {
@@ -284,7 +430,7 @@ void TransportSender<MyState>::rationalize_states( void )
 
   current_state.subtract( known_receiver_state );
 
-  for ( typename std::list<TimestampedState<MyState>>::reverse_iterator i = sent_states.rbegin();
+  for ( typename sent_states_type::reverse_iterator i = sent_states.rbegin();
         i != sent_states.rend();
         i++ ) {
     i->state.subtract( known_receiver_state );
@@ -294,7 +440,6 @@ void TransportSender<MyState>::rationalize_states( void )
 template<class MyState>
 const std::string TransportSender<MyState>::make_chaff( void )
 {
-  const size_t CHAFF_MAX = 16;
   const size_t chaff_len = prng.uint8() % ( CHAFF_MAX + 1 );
 
   char chaff[CHAFF_MAX];
@@ -302,8 +447,68 @@ const std::string TransportSender<MyState>::make_chaff( void )
   return std::string( chaff, chaff_len );
 }
 
+/* Pads inst with chaff until it fills a single datagram of the given
+   size, or nearly, and sends that as a path MTU probe.  Returns false,
+   leaving inst as it was, if compression kept it from fitting or the
+   probe could not be sent. */
+template<class MyState>
+bool TransportSender<MyState>::send_probe( Instruction& inst, int size )
+{
+  const std::string chaff = inst.chaff();
+  const size_t fragment_MTU = size - Network::Connection::ADDED_BYTES - Crypto::Session::ADDED_BYTES;
+  const size_t target = fragment_MTU - Fragment::frag_header_len;
+
+  std::string padding( target, 0 );
+  prng.fill( &padding[0], padding.size() ); /* random, so that it won't compress */
+  long pad = 0;
+
+  fragmenter.set_parity_group( 0 );
+  for ( int i = 0; i < PROBE_PAD_ATTEMPTS; i++ ) {
+    inst.set_chaff( padding.data(), size_t( pad ) );
+    paced = fragmenter.make_fragments( inst, fragment_MTU );
+
+    size_t len = 0;
+    for ( std::vector<FragmentView>::const_iterator j = paced.begin(); j != paced.end(); j++ ) {
+      len += j->len;
+    }
+    if ( ( paced.size() == 1 ) && ( ( len == target ) || ( i == PROBE_PAD_ATTEMPTS - 1 ) ) ) {
+      const int probe = size - int( target - len );
+      char header[Fragment::frag_header_len];
+      paced[0].write_header( header );
+      struct iovec iov[2];
+      iov[0].iov_base = header;
+      iov[0].iov_len = sizeof( header );
+      iov[1].iov_base = const_cast<char*>( paced[0].data );
+      iov[1].iov_len = paced[0].len;
+      const bool sent = connection->send_MTU_probe( iov, 2, probe );
+      probe_sent = timestamp();
+
+      if ( verbose ) {
+        fprintf( stderr,
+                 "[%u] Path MTU probe of %d bytes %s [%d], MTU %d\n",
+                 (unsigned int)( timestamp() % 100000 ),
+                 probe,
+                 sent ? "sent" : "refused",
+                 (int)inst.new_num(),
+                 connection->get_MTU() );
+      }
+      if ( sent ) {
+        probe_pending = true;
+        probe_num = inst.new_num();
+        probe_size = probe;
+        return true;
+      }
+      break;
+    }
+    pad = std::max( 0L, std::min( long( target ), pad + long( target ) - long( len ) ) );
+  }
+
+  inst.set_chaff( chaff );
+  return false;
+}
+
 template<class MyState>
-void TransportSender<MyState>::send_in_fragments( const std::string& diff, uint64_t new_num )
+void TransportSender<MyState>::send_in_fragments( const std::string& diff, uint64_t new_num, int probe )
 {
   Instruction inst;
 
@@ -314,58 +519,179 @@ void TransportSender<MyState>::send_in_fragments( const std::string& diff, uint6
   inst.set_throwaway_num( sent_states.front().num );
   inst.set_diff( diff );
   inst.set_chaff( make_chaff() );
+  inst.set_capabilities( capabilities );
+  if ( remote_capabilities & CAPABILITY_ECN_FEEDBACK ) {
+    inst.set_ecn_ect( connection->get_ecn_ect_received() );
+    inst.set_ecn_ce( connection->get_ecn_ce_received() );
+  }
 
   if ( new_num == uint64_t( -1 ) ) {
     shutdown_tries++;
   }
 
-  std::vector<Fragment> fragments = fragmenter.make_fragments(
-    inst, connection->get_MTU() - Network::Connection::ADDED_BYTES - Crypto::Session::ADDED_BYTES );
-  for ( std::vector<Fragment>::iterator i = fragments.begin(); i != fragments.end(); i++ ) {
-    connection->send( i->tostring() );
+  if ( probe_pending && ( new_num == probe_num ) ) { /* its ack would no longer tell */
+    probe_pending = false;
+  }
 
-    if ( verbose ) {
-      fprintf(
-        stderr,
-        "[%u] Sent [%d=>%d] id %d, frag %d ack=%d, throwaway=%d, len=%d, frame rate=%.2f, timeout=%d, srtt=%.1f\n",
-        (unsigned int)( timestamp() % 100000 ),
-        (int)inst.old_num(),
-        (int)inst.new_num(),
-        (int)i->id,
-        (int)i->fragment_num,
-        (int)inst.ack_num(),
-        (int)inst.throwaway_num(),
-        (int)i->contents.size(),
-        1000.0 / (double)send_interval(),
-        (int)connection->timeout(),
-        connection->get_SRTT() );
+  /* Instructions that fill datagrams have gone unacknowledged, time
+     and again, for longer than any RTO: smaller ones may fare better. */
+  if ( ( full_size_sends >= BLACK_HOLE_SENDS ) && ( timestamp() - full_size_since > BLACK_HOLE_TIMEOUT ) ) {
+    const int MTU = connection->get_MTU();
+    connection->MTU_black_hole();
+    full_size_sends = 0;
+    if ( verbose && ( connection->get_MTU() != MTU ) ) {
+      fprintf( stderr,
+               "[%u] Path MTU black hole at %d bytes, MTU %d\n",
+               (unsigned int)( timestamp() % 100000 ),
+               MTU,
+               connection->get_MTU() );
     }
   }
 
+  /* a probe goes out at once, and anything else paced */
+  paced_next = 0;
+  if ( ( probe > 0 ) && send_probe( inst, probe ) ) {
+    paced_next = paced.size();
+  } else {
+    fragmenter.set_parity_group( parity_group() );
+    paced = fragmenter.make_fragments( inst, fragment_payload() );
+    if ( ( paced.size() > 1 ) && ( full_size_sends++ == 0 ) ) {
+      full_size_since = timestamp();
+    }
+  }
+
+  size_t bytes = 0;
+  for ( std::vector<FragmentView>::const_iterator i = paced.begin(); i != paced.end(); i++ ) {
+    bytes += Network::Connection::ADDED_BYTES + Crypto::Session::ADDED_BYTES + Fragment::frag_header_len + i->len;
+  }
+  if ( new_num != uint64_t( -1 ) ) {
+    unacked_bytes[new_num] += bytes;
+    if ( unacked_bytes.size() > SENT_STATES_MAX ) { /* culled, or never to be acked */
+      unacked_bytes.erase( unacked_bytes.begin() );
+    }
+  }
+  if ( !diff.empty() ) {
+    last_frame_bytes = bytes;
+  }
+
+  send_paced();
+
   pending_data_ack = false;
 }
 
+template<class MyState>
+void TransportSender<MyState>::send_paced( void )
+{
+  /* unpaced until there is an RTT to pace by */
+  const double rate = congestion.measured() ? congestion.pacing_rate( connection->get_SRTT() ) : 0;
+  const double now = timestamp();
+  if ( rate > 0 ) {
+    pace_clock = std::max( pace_clock, now - PACING_BURST * DELAY_DATAGRAM / rate );
+  }
+
+  /* everything the pacer allows now goes out in one batch */
+  const Instruction& inst = fragmenter.get_last_instruction();
+  while ( ( paced_next < paced.size() ) && ( ( rate == 0 ) || ( pace_clock <= now ) ) ) {
+    char headers[Connection::SEND_BATCH_MAX][Fragment::frag_header_len];
+    struct iovec iov[Connection::SEND_BATCH_MAX][2];
+    Connection::Datagram batch[Connection::SEND_BATCH_MAX];
+    const size_t first = paced_next;
+    int count = 0;
+
+    while ( ( count < Connection::SEND_BATCH_MAX ) && ( paced_next < paced.size() )
+            && ( ( rate == 0 ) || ( pace_clock <= now ) ) ) {
+      const FragmentView& frag = paced[paced_next++];
+      frag.write_header( headers[count] );
+
+      iov[count][0].iov_base = headers[count];
+      iov[count][0].iov_len = Fragment::frag_header_len;
+      iov[count][1].iov_base = const_cast<char*>( frag.data );
+      iov[count][1].iov_len = frag.len;
+      batch[count].iov = iov[count];
+      batch[count].iovcnt = 2;
+      batch[count].urgent = ( paced.size() == 1 ); /* keystrokes and acks fit in one */
+      count++;
+
+      if ( rate > 0 ) {
+        pace_clock += ( Fragment::frag_header_len + frag.len ) / rate;
+      }
+    }
+
+    connection->send( batch, count );
+
+    if ( verbose ) {
+      for ( size_t i = first; i < paced_next; i++ ) {
+        const FragmentView& frag = paced[i];
+        fprintf(
+          stderr,
+          "[%u] Sent [%d=>%d] id %d, frag %d ack=%d, throwaway=%d, len=%d, frame rate=%.2f, timeout=%d, "
+          "srtt=%.1f\n",
+          (unsigned int)( timestamp() % 100000 ),
+          (int)inst.old_num(),
+          (int)inst.new_num(),
+          (int)frag.id,
+          (int)frag.fragment_num,
+          (int)inst.ack_num(),
+          (int)inst.throwaway_num(),
+          (int)frag.len,
+          1000.0 / (double)send_interval(),
+          (int)connection->timeout(),
+          connection->get_SRTT() );
+      }
+    }
+  }
+}
+
 template<class MyState>
 void TransportSender<MyState>::process_acknowledgment_through( uint64_t ack_num )
 {
-  /* Ignore ack if we have culled the state it's acknowledging */
+  if ( connection->get_RTT_samples() != last_RTT_samples ) {
+    last_RTT_samples = connection->get_RTT_samples();
+    congestion.rtt_sample( connection->get_last_RTT(), timestamp() );
+  }
 
-  typename sent_states_type::iterator i;
-  for ( i = sent_states.begin(); i != sent_states.end(); i++ ) {
-    if ( i->num == ack_num ) {
-      break;
+  size_t flight = 0, acked = 0;
+  for ( std::map<uint64_t, size_t>::const_iterator j = unacked_bytes.begin(); j != unacked_bytes.end(); j++ ) {
+    flight += j->second;
+    if ( j->first <= ack_num ) {
+      acked += j->second;
     }
   }
+  if ( acked > 0 ) {
+    unacked_bytes.erase( unacked_bytes.begin(), unacked_bytes.upper_bound( ack_num ) );
+    congestion.ack( acked, flight );
+  }
 
-  if ( i != sent_states.end() ) {
-    for ( i = sent_states.begin(); i != sent_states.end(); ) {
-      typename sent_states_type::iterator i_next = i;
-      i_next++;
-      if ( i->num < ack_num ) {
-        sent_states.erase( i );
-      }
-      i = i_next;
+  if ( probe_pending && ( ack_num == probe_num ) ) {
+    probe_pending = false;
+    connection->MTU_probe_acked( probe_size );
+    if ( verbose ) {
+      fprintf( stderr,
+               "[%u] Path MTU probe of %d bytes acknowledged, MTU %d\n",
+               (unsigned int)( timestamp() % 100000 ),
+               probe_size,
+               connection->get_MTU() );
+    }
+  }
+
+  /* Ignore ack if we have culled the state it's acknowledging */
+
+  typename sent_states_type::iterator i = lower_bound_num( sent_states, ack_num );
+
+  if ( ( i != sent_states.end() ) && ( i->num == ack_num ) ) {
+    /* A state sent within ACK_DELAY of the probe may have displaced
+       its ack, and then the probe tells nothing. */
+    if ( probe_pending && ( ack_num > probe_num ) && ( i->timestamp < probe_sent + ACK_DELAY ) ) {
+      probe_pending = false;
+    }
+
+    if ( ack_num > last_delivered_num ) {
+      record_delivery( true );
+      last_delivered_num = ack_num;
+      full_size_sends = 0;
     }
+
+    sent_states.erase( sent_states.begin(), i );
   }
   assert( !sent_states.empty() );
 }
@@ -392,25 +718,114 @@ void TransportSender<MyState>::set_ack_num( uint64_t s_ack_num )
   ack_num = s_ack_num;
 }
 
-/* Investigate diff against known receiver state instead */
-/* Mutates proposed_diff */
 template<class MyState>
-void TransportSender<MyState>::attempt_prospective_resend_optimization( std::string& proposed_diff )
+size_t TransportSender<MyState>::fragment_payload( void ) const
 {
-  if ( assumed_receiver_state == sent_states.begin() ) {
-    return;
+  return connection->get_MTU() - Network::Connection::ADDED_BYTES - Crypto::Session::ADDED_BYTES;
+}
+
+template<class MyState>
+void TransportSender<MyState>::record_delivery( bool delivered )
+{
+  delivery_ratio += DELIVERY_RATIO_GAIN * ( ( delivered ? 1.0 : 0.0 ) - delivery_ratio );
+  if ( !delivered ) {
+    congestion.loss( timestamp(), connection->get_SRTT() );
+  }
+}
+
+/* Data fragments per parity fragment, or 0 for none.  Instructions
+   are lost at least as often as fragments, so this errs toward more
+   parity. */
+template<class MyState>
+size_t TransportSender<MyState>::parity_group( void ) const
+{
+  const double loss = 1.0 - delivery_ratio;
+  if ( loss < PARITY_MIN_LOSS ) {
+    return 0;
+  }
+  return std::max( PARITY_GROUP_MIN, std::min( PARITY_GROUP_MAX, size_t( PARITY_LOSS_BUDGET / loss ) ) );
+}
+
+/* Pick the reference for the next diff among the states the receiver
+   may hold.  The acknowledged state is certain.  A state sent recently
+   enough that its ack is not yet overdue is there with probability
+   delivery_ratio.  If it isn't, the instruction is wasted and the diff
+   from the acknowledged state follows, so each candidate costs its own
+   estimated diff plus that risk-weighted fallback.
+
+   Estimates are not free, so of the unacknowledged states only the
+   oldest, the newest and the current reference are candidates: the
+   oldest is the likeliest to have arrived, the newest gives the
+   shortest diff, and keeping the reference keeps the diffs cached. */
+template<class MyState>
+void TransportSender<MyState>::choose_reference_state( void )
+{
+  const uint64_t now = timestamp();
+  const uint64_t ack_deadline = connection->timeout() + ACK_DELAY;
+
+  typename sent_states_type::iterator oldest = sent_states.end(), newest = sent_states.end();
+  bool keep_assumed = false;
+  typename sent_states_type::iterator i = sent_states.begin();
+  for ( i++; i != sent_states.end(); i++ ) {
+    if ( uint64_t( now - i->timestamp ) >= ack_deadline ) { /* probably lost */
+      if ( i->num > last_overdue_num ) {
+        /* a lost probe says nothing of congestion */
+        if ( ( i->num != probe_num ) && ( i->timestamp >= last_loss_sent + ACK_DELAY ) ) {
+          record_delivery( false );
+          last_loss_sent = i->timestamp;
+        }
+        last_overdue_num = i->num;
+      }
+      continue;
+    }
+    if ( probe_pending && ( i->num == probe_num ) ) { /* as likely lost as not */
+      continue;
+    }
+    if ( oldest == sent_states.end() ) {
+      oldest = i;
+    }
+    newest = i;
+    keep_assumed = keep_assumed || ( i == assumed_receiver_state );
   }
 
-  std::string resend_diff = current_state.diff_from( sent_states.front().state );
+  const size_t resend_size = current_state.estimate_diff_size( sent_states.front().state );
+  typename sent_states_type::iterator best = sent_states.begin();
+  double best_cost = resend_size;
+  size_t best_size = resend_size;
 
-  /* We do a prophylactic resend if it would make the diff shorter,
-     or if it would lengthen it by no more than 100 bytes and still be
-     less than 1000 bytes. */
+  /* in order of num, so that ties go to the older state */
+  typename sent_states_type::iterator candidates[3] = { oldest, sent_states.end(), newest };
+  if ( keep_assumed && ( assumed_receiver_state != oldest ) && ( assumed_receiver_state != newest ) ) {
+    candidates[1] = assumed_receiver_state;
+  }
+  for ( int c = 0; c < 3; c++ ) {
+    if ( ( candidates[c] == sent_states.end() ) || ( ( c == 2 ) && ( candidates[c] == oldest ) ) ) {
+      continue;
+    }
+    const size_t size = current_state.estimate_diff_size( candidates[c]->state );
+    const double cost = size + ( 1.0 - delivery_ratio ) * resend_size;
+    if ( cost < best_cost ) {
+      best = candidates[c];
+      best_cost = cost;
+      best_size = size;
+    }
+  }
 
-  if ( ( resend_diff.size() <= proposed_diff.size() )
-       || ( ( resend_diff.size() < 1000 ) && ( resend_diff.size() - proposed_diff.size() < 100 ) ) ) {
-    assumed_receiver_state = sent_states.begin();
-    proposed_diff = resend_diff;
+  /* We do a prophylactic resend from the acknowledged state if it
+     would lengthen the diff only slightly and still be small. */
+  const size_t payload = fragment_payload();
+  if ( ( resend_size < RESEND_MAX_FRAGMENTS * payload ) && ( resend_size - best_size < payload / RESEND_SLACK ) ) {
+    best = sent_states.begin();
+  }
+
+  assumed_receiver_state = best;
+
+  if ( best == sent_states.begin() ) {
+    references_acked++;
+  } else if ( ++best == sent_states.end() ) {
+    references_newest++;
+  } else {
+    references_intermediate++;
   }
 }
 
@@ -33,10 +33,13 @@
 #ifndef TRANSPORT_SENDER_HPP
 #define TRANSPORT_SENDER_HPP
 
-#include <list>
+#include <deque>
+#include <map>
 #include <string>
 
 #include "src/crypto/prng.h"
+#include "src/network/compressor.h"
+#include "src/network/delaycontroller.h"
 #include "src/network/network.h"
 #include "src/protobufs/transportinstruction.pb.h"
 #include "transportfragment.h"
@@ -52,6 +55,48 @@ const int ACK_INTERVAL = 3000;          /* ms between empty acks */
 const int ACK_DELAY = 100;              /* ms before delayed ack */
 const int SHUTDOWN_RETRIES = 16;        /* number of shutdown packets to send before giving up */
 const int ACTIVE_RETRY_TIMEOUT = 10000; /* attempt to resend at frame rate */
+const size_t DIFF_CACHE_MAX = 32;       /* memoized diffs to the current state */
+const size_t CHAFF_MAX = 16;            /* bytes of chaff, except on path MTU probes */
+
+/* path MTU probes */
+const int PROBE_INTERVAL = 1000;            /* ms between probes, when there is nothing else to send */
+const int PROBE_TIMEOUT = 2 * ACK_INTERVAL; /* ms past the RTO to wait for a probe's ack */
+const int PROBE_PAD_ATTEMPTS = 4;           /* compressions to size a probe's padding */
+const int BLACK_HOLE_SENDS = 3;             /* unacknowledged instructions that fill datagrams, */
+const uint64_t BLACK_HOLE_TIMEOUT = 3000;   /* ... over this many ms, before the MTU falls back */
+
+/* limits on the sent state queue */
+const size_t SENT_STATES_MAX = 32;    /* beyond this, drop a state from the middle */
+const size_t SENT_STATES_NEWEST = 16; /* ... keeping this many of the newest */
+
+/* Prospective resend from the acknowledged state: worthwhile when the
+   estimated diff is still small (at most this many fragments) and
+   larger than the best alternative by less than 1/RESEND_SLACK of a
+   fragment. */
+const size_t RESEND_MAX_FRAGMENTS = 2;
+const size_t RESEND_SLACK = 5;
+
+/* weight of each new sample in the delivery ratio */
+const double DELIVERY_RATIO_GAIN = 1.0 / 16;
+
+/* Parity fragments once the loss rate (1 - delivery ratio) reaches
+   PARITY_MIN_LOSS.  One parity fragment rebuilds a single lost fragment
+   in its group, so groups shrink as loss grows, keeping the expected
+   losses per group near PARITY_LOSS_BUDGET. */
+const double PARITY_MIN_LOSS = 0.01;
+const double PARITY_LOSS_BUDGET = 0.2;
+const size_t PARITY_GROUP_MIN = 2;
+const size_t PARITY_GROUP_MAX = 16;
+
+/* A diff from one sent state to the current state */
+class CachedDiff
+{
+public:
+  std::string diff;
+  uint64_t cost; /* us it took to compute */
+
+  CachedDiff( const std::string& s_diff, uint64_t s_cost ) : diff( s_diff ), cost( s_cost ) {}
+};
 
 template<class MyState>
 class TransportSender
@@ -59,20 +104,26 @@ class TransportSender
 private:
   /* helper methods for tick() */
   void update_assumed_receiver_state( void );
-  void attempt_prospective_resend_optimization( std::string& proposed_diff );
+  void choose_reference_state( void );
+  void record_delivery( bool delivered );
+  size_t parity_group( void ) const;
+  size_t fragment_payload( void ) const;
   void rationalize_states( void );
   void send_to_receiver( const std::string& diff );
   void send_empty_ack( void );
-  void send_in_fragments( const std::string& diff, uint64_t new_num );
+  void send_in_fragments( const std::string& diff, uint64_t new_num, int probe = 0 );
+  bool send_probe( Instruction& inst, int size );
+  void send_paced( void );
   void add_sent_state( uint64_t the_timestamp, uint64_t num, MyState& state );
+  std::string diff_from_sent_state( const TimestampedState<MyState>& source );
 
   /* state of sender */
   Connection* connection;
 
   MyState current_state;
 
-  using sent_states_type = std::list<TimestampedState<MyState>>;
-  sent_states_type sent_states;
+  using sent_states_type = std::deque<TimestampedState<MyState>>;
+  sent_states_type sent_states; /* in order of num */
   /* first element: known, acknowledged receiver state */
   /* last element: last sent state */
 
@@ -107,6 +158,56 @@ private:
 
   uint64_t mindelay_clock; /* time of first pending change to current state */
 
+  uint32_t capabilities;        /* advertised to the receiver */
+  uint32_t remote_capabilities; /* advertised by the receiver */
+
+  /* Diffs to current_state, keyed by the num of the sent state they
+     start from.  Retransmissions and prospective resends ask for the
+     same diffs repeatedly until current_state changes, which shows as
+     a new generation. */
+  using diff_cache_type = std::map<uint64_t, CachedDiff>;
+  diff_cache_type diff_cache;
+  uint64_t diff_cache_gen; /* current_state's generation when the diffs were made */
+  uint64_t diff_cache_hits;
+  uint64_t diff_cache_misses;
+  uint64_t diff_cache_saved; /* us not spent recomputing diffs */
+
+  /* Ack history: how often a sent state is acknowledged before its
+     ack is overdue.  Weighs the unacknowledged reference candidates.
+     One ack covers every state sent in an ack delay, so overdue states
+     count as at most one loss per ack delay of sending. */
+  double delivery_ratio;
+  uint64_t last_delivered_num;
+  uint64_t last_overdue_num;
+  uint64_t last_loss_sent; /* send time of the last overdue state counted as a loss */
+
+  /* which reference choose_reference_state() picked */
+  uint64_t references_acked;
+  uint64_t references_newest;
+  uint64_t references_intermediate;
+
+  /* congestion control */
+  DelayController congestion;
+  uint64_t last_RTT_samples;                /* Connection's RTT samples already given to it */
+  std::map<uint64_t, size_t> unacked_bytes; /* bytes sent, by state num */
+  size_t last_frame_bytes;                  /* bytes sent for the last diff */
+
+  /* Path MTU probes are empty acks padded with chaff, which the
+     receiver acknowledges at once.  Only one is outstanding. */
+  bool probe_pending;
+  uint64_t probe_num;       /* state num of the last probe */
+  int probe_size;           /* ... the size of its datagram */
+  uint64_t probe_sent;      /* ... and when it went, or had its turn */
+  int full_size_sends;      /* instructions sent in several datagrams since the last ack */
+  uint64_t full_size_since; /* ... and when the first of them went */
+
+  /* Fragments of the last instruction, sent by tick() no faster than
+     the pacing rate.  No new instruction is made until they are all
+     sent, which keeps the Fragmenter's payload they point into valid. */
+  std::vector<FragmentView> paced;
+  size_t paced_next;
+  double pace_clock; /* ms when the next one may go */
+
 public:
   /* constructor */
   TransportSender( Connection* s_connection, MyState& initial_state );
@@ -126,6 +227,9 @@ public:
   /* Accelerate reply ack */
   void set_data_ack( void ) { pending_data_ack = true; }
 
+  /* Sends at least an ack on the next tick, as from a new address */
+  void set_ack_now( void ) { next_ack_time = timestamp(); }
+
   /* Received something */
   void remote_heard( uint64_t ts ) { last_heard = ts; }
 
@@ -152,6 +256,22 @@ public:
     current_state.reset_input();
   }
   void set_verbose( unsigned int s_verbose ) { verbose = s_verbose; }
+  /* Transport features and Compressor formats are always advertised */
+  void set_capabilities( uint32_t s_capabilities )
+  {
+    capabilities = s_capabilities | TRANSPORT_CAPABILITIES | get_compressor().capabilities();
+  }
+  void set_remote_capabilities( uint32_t remote )
+  {
+    remote_capabilities = remote;
+    fragmenter.set_remote_capabilities( remote );
+  }
+
+  /* Executed upon receipt of the receiver's ECN counts */
+  void process_ecn_counts( uint64_t ect, uint64_t ce )
+  {
+    congestion.ecn_counts( ect, ce, timestamp(), connection->get_SRTT() );
+  }
 
   bool get_shutdown_in_progress( void ) const { return shutdown_in_progress; }
   bool get_shutdown_acknowledged( void ) const { return sent_states.front().num == uint64_t( -1 ); }
@@ -159,6 +279,7 @@ public:
   uint64_t get_sent_state_acked_timestamp( void ) const { return sent_states.front().timestamp; }
   uint64_t get_sent_state_acked( void ) const { return sent_states.front().num; }
   uint64_t get_sent_state_last( void ) const { return sent_states.back().num; }
+  uint64_t get_diff_cache_hits( void ) const { return diff_cache_hits; }
 
   bool shutdown_ack_timed_out( void ) const;
 
@@ -166,6 +287,8 @@ public:
 
   unsigned int send_interval( void ) const;
 
+  const DelayController& get_congestion( void ) const { return congestion; }
+
   /* nonexistent methods to satisfy -Weffc++ */
   TransportSender( const TransportSender& x );
   TransportSender& operator=( const TransportSender& x );
@@ -33,6 +33,11 @@
 #ifndef TRANSPORT_STATE_HPP
 #define TRANSPORT_STATE_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+
 namespace Network {
 template<class State>
 class TimestampedState
@@ -45,7 +50,37 @@ public:
   TimestampedState( uint64_t s_timestamp, uint64_t s_num, const State& s_state )
     : timestamp( s_timestamp ), num( s_num ), state( s_state )
   {}
+
+  static bool num_less( const TimestampedState& s, uint64_t n ) { return s.num < n; }
 };
+
+/* Queues of states are kept in order of num, so the first state
+   numbered num or later is a binary search away. */
+template<class Container>
+typename Container::iterator lower_bound_num( Container& states, uint64_t num )
+{
+  return std::lower_bound( states.begin(), states.end(), num, Container::value_type::num_less );
+}
+
+/* Approximate memory held by a queue of states, with storage shared
+   between them (e.g. unchanged screen rows) counted once, and storage
+   already in seen counted as free. */
+template<class Container>
+size_t history_memory_usage( const Container& states, std::unordered_set<const void*>& seen )
+{
+  size_t total = 0;
+  for ( typename Container::const_iterator i = states.begin(); i != states.end(); i++ ) {
+    total += i->state.memory_usage( seen );
+  }
+  return total;
+}
+
+template<class Container>
+size_t history_memory_usage( const Container& states )
+{
+  std::unordered_set<const void*> seen;
+  return history_memory_usage( states, seen );
+}
 }
 
 #endif
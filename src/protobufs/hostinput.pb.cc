@@ -0,0 +1,2778 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: hostinput.proto
+
+#include "hostinput.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace HostBuffers {
+PROTOBUF_CONSTEXPR HostMessage::HostMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.instruction_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HostMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HostMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HostMessageDefaultTypeInternal() {}
+  union {
+    HostMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HostMessageDefaultTypeInternal _HostMessage_default_instance_;
+PROTOBUF_CONSTEXPR Instruction::Instruction(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._extensions_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct InstructionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InstructionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InstructionDefaultTypeInternal() {}
+  union {
+    Instruction _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InstructionDefaultTypeInternal _Instruction_default_instance_;
+PROTOBUF_CONSTEXPR HostBytes::HostBytes(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hoststring_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct HostBytesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HostBytesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HostBytesDefaultTypeInternal() {}
+  union {
+    HostBytes _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HostBytesDefaultTypeInternal _HostBytes_default_instance_;
+PROTOBUF_CONSTEXPR ResizeMessage::ResizeMessage(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0} {}
+struct ResizeMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResizeMessageDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResizeMessageDefaultTypeInternal() {}
+  union {
+    ResizeMessage _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResizeMessageDefaultTypeInternal _ResizeMessage_default_instance_;
+PROTOBUF_CONSTEXPR EchoAck::EchoAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.echo_ack_num_)*/uint64_t{0u}} {}
+struct EchoAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EchoAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EchoAckDefaultTypeInternal() {}
+  union {
+    EchoAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EchoAckDefaultTypeInternal _EchoAck_default_instance_;
+PROTOBUF_CONSTEXPR RenditionEntry::RenditionEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.foreground_)*/0u
+  , /*decltype(_impl_.background_)*/0u
+  , /*decltype(_impl_.attributes_)*/0u} {}
+struct RenditionEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RenditionEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RenditionEntryDefaultTypeInternal() {}
+  union {
+    RenditionEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RenditionEntryDefaultTypeInternal _RenditionEntry_default_instance_;
+PROTOBUF_CONSTEXPR HyperlinkEntry::HyperlinkEntry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.params_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.url_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct HyperlinkEntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HyperlinkEntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HyperlinkEntryDefaultTypeInternal() {}
+  union {
+    HyperlinkEntry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HyperlinkEntryDefaultTypeInternal _HyperlinkEntry_default_instance_;
+PROTOBUF_CONSTEXPR Text::Text(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.codepoint_)*/{}
+  , /*decltype(_impl_._codepoint_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TextDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TextDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TextDefaultTypeInternal() {}
+  union {
+    Text _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TextDefaultTypeInternal _Text_default_instance_;
+PROTOBUF_CONSTEXPR FrameUpdate::FrameUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rendition_table_)*/{}
+  , /*decltype(_impl_.hyperlink_table_)*/{}
+  , /*decltype(_impl_.rows_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.icon_name_)*/nullptr
+  , /*decltype(_impl_.window_title_)*/nullptr
+  , /*decltype(_impl_.clipboard_)*/nullptr
+  , /*decltype(_impl_.cursor_row_)*/0u
+  , /*decltype(_impl_.cursor_col_)*/0u
+  , /*decltype(_impl_.current_rendition_)*/0u
+  , /*decltype(_impl_.current_hyperlink_)*/0u
+  , /*decltype(_impl_.cursor_visible_)*/false
+  , /*decltype(_impl_.reverse_video_)*/false
+  , /*decltype(_impl_.bracketed_paste_)*/false
+  , /*decltype(_impl_.mouse_focus_event_)*/false
+  , /*decltype(_impl_.mouse_reporting_mode_)*/0u
+  , /*decltype(_impl_.mouse_encoding_mode_)*/0u
+  , /*decltype(_impl_.mouse_alternate_scroll_)*/false
+  , /*decltype(_impl_.title_initialized_)*/false
+  , /*decltype(_impl_.bell_count_)*/0u} {}
+struct FrameUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FrameUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FrameUpdateDefaultTypeInternal() {}
+  union {
+    FrameUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FrameUpdateDefaultTypeInternal _FrameUpdate_default_instance_;
+}  // namespace HostBuffers
+namespace HostBuffers {
+
+// ===================================================================
+
+class HostMessage::_Internal {
+ public:
+};
+
+HostMessage::HostMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.HostMessage)
+}
+HostMessage::HostMessage(const HostMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  HostMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instruction_){from._impl_.instruction_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.HostMessage)
+}
+
+inline void HostMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.instruction_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HostMessage::~HostMessage() {
+  // @@protoc_insertion_point(destructor:HostBuffers.HostMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HostMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.instruction_.~RepeatedPtrField();
+}
+
+void HostMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HostMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.HostMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.instruction_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* HostMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .HostBuffers.Instruction instruction = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_instruction(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HostMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.HostMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .HostBuffers.Instruction instruction = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_instruction_size()); i < n; i++) {
+    const auto& repfield = this->_internal_instruction(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.HostMessage)
+  return target;
+}
+
+size_t HostMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.HostMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HostBuffers.Instruction instruction = 1;
+  total_size += 1UL * this->_internal_instruction_size();
+  for (const auto& msg : this->_impl_.instruction_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void HostMessage::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const HostMessage*>(
+      &from));
+}
+
+void HostMessage::MergeFrom(const HostMessage& from) {
+  HostMessage* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.HostMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.instruction_.MergeFrom(from._impl_.instruction_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void HostMessage::CopyFrom(const HostMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.HostMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HostMessage::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.instruction_))
+    return false;
+  return true;
+}
+
+void HostMessage::InternalSwap(HostMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.instruction_.InternalSwap(&other->_impl_.instruction_);
+}
+
+std::string HostMessage::GetTypeName() const {
+  return "HostBuffers.HostMessage";
+}
+
+
+// ===================================================================
+
+class Instruction::_Internal {
+ public:
+};
+
+Instruction::Instruction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.Instruction)
+}
+Instruction::Instruction(const Instruction& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Instruction* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.Instruction)
+}
+
+inline void Instruction::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._extensions_)*/{::_pbi::ArenaInitialized(), arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Instruction::~Instruction() {
+  // @@protoc_insertion_point(destructor:HostBuffers.Instruction)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Instruction::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_._extensions_.~ExtensionSet();
+}
+
+void Instruction::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Instruction::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.Instruction)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_._extensions_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Instruction::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    if ((16u <= tag)) {
+      ptr = _impl_._extensions_.ParseField(tag, ptr, internal_default_instance(), &_internal_metadata_, ctx);
+      CHK_(ptr != nullptr);
+      continue;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Instruction::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.Instruction)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // Extension range [2, 536870912)
+  target = _impl_._extensions_._InternalSerialize(
+  internal_default_instance(), 2, 536870912, target, stream);
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.Instruction)
+  return target;
+}
+
+size_t Instruction::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.Instruction)
+  size_t total_size = 0;
+
+  total_size += _impl_._extensions_.ByteSize();
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Instruction::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Instruction*>(
+      &from));
+}
+
+void Instruction::MergeFrom(const Instruction& from) {
+  Instruction* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.Instruction)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_._extensions_.MergeFrom(internal_default_instance(), from._impl_._extensions_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Instruction::CopyFrom(const Instruction& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.Instruction)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Instruction::IsInitialized() const {
+  if (!_impl_._extensions_.IsInitialized()) {
+    return false;
+  }
+
+  return true;
+}
+
+void Instruction::InternalSwap(Instruction* other) {
+  using std::swap;
+  _impl_._extensions_.InternalSwap(&other->_impl_._extensions_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+}
+
+std::string Instruction::GetTypeName() const {
+  return "HostBuffers.Instruction";
+}
+
+
+// ===================================================================
+
+class HostBytes::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HostBytes>()._impl_._has_bits_);
+  static void set_has_hoststring(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+HostBytes::HostBytes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.HostBytes)
+}
+HostBytes::HostBytes(const HostBytes& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  HostBytes* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hoststring_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.hoststring_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hoststring_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hoststring()) {
+    _this->_impl_.hoststring_.Set(from._internal_hoststring(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.HostBytes)
+}
+
+inline void HostBytes::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hoststring_){}
+  };
+  _impl_.hoststring_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hoststring_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HostBytes::~HostBytes() {
+  // @@protoc_insertion_point(destructor:HostBuffers.HostBytes)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HostBytes::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hoststring_.Destroy();
+}
+
+void HostBytes::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HostBytes::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.HostBytes)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.hoststring_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* HostBytes::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes hoststring = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_hoststring();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HostBytes::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.HostBytes)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes hoststring = 4;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_hoststring(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.HostBytes)
+  return target;
+}
+
+size_t HostBytes::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.HostBytes)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional bytes hoststring = 4;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_hoststring());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void HostBytes::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const HostBytes*>(
+      &from));
+}
+
+void HostBytes::MergeFrom(const HostBytes& from) {
+  HostBytes* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.HostBytes)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_hoststring()) {
+    _this->_internal_set_hoststring(from._internal_hoststring());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void HostBytes::CopyFrom(const HostBytes& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.HostBytes)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HostBytes::IsInitialized() const {
+  return true;
+}
+
+void HostBytes::InternalSwap(HostBytes* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hoststring_, lhs_arena,
+      &other->_impl_.hoststring_, rhs_arena
+  );
+}
+
+std::string HostBytes::GetTypeName() const {
+  return "HostBuffers.HostBytes";
+}
+
+
+// ===================================================================
+
+class ResizeMessage::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ResizeMessage>()._impl_._has_bits_);
+  static void set_has_width(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_height(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+ResizeMessage::ResizeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.ResizeMessage)
+}
+ResizeMessage::ResizeMessage(const ResizeMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ResizeMessage* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.height_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.ResizeMessage)
+}
+
+inline void ResizeMessage::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+  };
+}
+
+ResizeMessage::~ResizeMessage() {
+  // @@protoc_insertion_point(destructor:HostBuffers.ResizeMessage)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResizeMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ResizeMessage::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResizeMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.ResizeMessage)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.width_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.height_) -
+        reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.height_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ResizeMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional int32 width = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_width(&has_bits);
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 height = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_height(&has_bits);
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResizeMessage::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.ResizeMessage)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional int32 width = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_width(), target);
+  }
+
+  // optional int32 height = 6;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_height(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.ResizeMessage)
+  return target;
+}
+
+size_t ResizeMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.ResizeMessage)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional int32 width = 5;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_width());
+    }
+
+    // optional int32 height = 6;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_height());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ResizeMessage::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ResizeMessage*>(
+      &from));
+}
+
+void ResizeMessage::MergeFrom(const ResizeMessage& from) {
+  ResizeMessage* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.ResizeMessage)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.width_ = from._impl_.width_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.height_ = from._impl_.height_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ResizeMessage::CopyFrom(const ResizeMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.ResizeMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResizeMessage::IsInitialized() const {
+  return true;
+}
+
+void ResizeMessage::InternalSwap(ResizeMessage* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ResizeMessage, _impl_.height_)
+      + sizeof(ResizeMessage::_impl_.height_)
+      - PROTOBUF_FIELD_OFFSET(ResizeMessage, _impl_.width_)>(
+          reinterpret_cast<char*>(&_impl_.width_),
+          reinterpret_cast<char*>(&other->_impl_.width_));
+}
+
+std::string ResizeMessage::GetTypeName() const {
+  return "HostBuffers.ResizeMessage";
+}
+
+
+// ===================================================================
+
+class EchoAck::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EchoAck>()._impl_._has_bits_);
+  static void set_has_echo_ack_num(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+EchoAck::EchoAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.EchoAck)
+}
+EchoAck::EchoAck(const EchoAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  EchoAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.echo_ack_num_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _this->_impl_.echo_ack_num_ = from._impl_.echo_ack_num_;
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.EchoAck)
+}
+
+inline void EchoAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.echo_ack_num_){uint64_t{0u}}
+  };
+}
+
+EchoAck::~EchoAck() {
+  // @@protoc_insertion_point(destructor:HostBuffers.EchoAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EchoAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EchoAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EchoAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.EchoAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.echo_ack_num_ = uint64_t{0u};
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* EchoAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 echo_ack_num = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_echo_ack_num(&has_bits);
+          _impl_.echo_ack_num_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EchoAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.EchoAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 echo_ack_num = 8;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_echo_ack_num(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.EchoAck)
+  return target;
+}
+
+size_t EchoAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.EchoAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional uint64 echo_ack_num = 8;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_echo_ack_num());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void EchoAck::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const EchoAck*>(
+      &from));
+}
+
+void EchoAck::MergeFrom(const EchoAck& from) {
+  EchoAck* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.EchoAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_echo_ack_num()) {
+    _this->_internal_set_echo_ack_num(from._internal_echo_ack_num());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void EchoAck::CopyFrom(const EchoAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.EchoAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EchoAck::IsInitialized() const {
+  return true;
+}
+
+void EchoAck::InternalSwap(EchoAck* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.echo_ack_num_, other->_impl_.echo_ack_num_);
+}
+
+std::string EchoAck::GetTypeName() const {
+  return "HostBuffers.EchoAck";
+}
+
+
+// ===================================================================
+
+class RenditionEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<RenditionEntry>()._impl_._has_bits_);
+  static void set_has_foreground(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_background(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_attributes(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+RenditionEntry::RenditionEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.RenditionEntry)
+}
+RenditionEntry::RenditionEntry(const RenditionEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  RenditionEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.foreground_){}
+    , decltype(_impl_.background_){}
+    , decltype(_impl_.attributes_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.foreground_, &from._impl_.foreground_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.attributes_) -
+    reinterpret_cast<char*>(&_impl_.foreground_)) + sizeof(_impl_.attributes_));
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.RenditionEntry)
+}
+
+inline void RenditionEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.foreground_){0u}
+    , decltype(_impl_.background_){0u}
+    , decltype(_impl_.attributes_){0u}
+  };
+}
+
+RenditionEntry::~RenditionEntry() {
+  // @@protoc_insertion_point(destructor:HostBuffers.RenditionEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RenditionEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RenditionEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RenditionEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.RenditionEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    ::memset(&_impl_.foreground_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.attributes_) -
+        reinterpret_cast<char*>(&_impl_.foreground_)) + sizeof(_impl_.attributes_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* RenditionEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 foreground = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_foreground(&has_bits);
+          _impl_.foreground_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 background = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_background(&has_bits);
+          _impl_.background_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 attributes = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_attributes(&has_bits);
+          _impl_.attributes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RenditionEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.RenditionEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint32 foreground = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_foreground(), target);
+  }
+
+  // optional uint32 background = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_background(), target);
+  }
+
+  // optional uint32 attributes = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_attributes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.RenditionEntry)
+  return target;
+}
+
+size_t RenditionEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.RenditionEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional uint32 foreground = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_foreground());
+    }
+
+    // optional uint32 background = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_background());
+    }
+
+    // optional uint32 attributes = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_attributes());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void RenditionEntry::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const RenditionEntry*>(
+      &from));
+}
+
+void RenditionEntry::MergeFrom(const RenditionEntry& from) {
+  RenditionEntry* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.RenditionEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.foreground_ = from._impl_.foreground_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.background_ = from._impl_.background_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.attributes_ = from._impl_.attributes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void RenditionEntry::CopyFrom(const RenditionEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.RenditionEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RenditionEntry::IsInitialized() const {
+  return true;
+}
+
+void RenditionEntry::InternalSwap(RenditionEntry* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RenditionEntry, _impl_.attributes_)
+      + sizeof(RenditionEntry::_impl_.attributes_)
+      - PROTOBUF_FIELD_OFFSET(RenditionEntry, _impl_.foreground_)>(
+          reinterpret_cast<char*>(&_impl_.foreground_),
+          reinterpret_cast<char*>(&other->_impl_.foreground_));
+}
+
+std::string RenditionEntry::GetTypeName() const {
+  return "HostBuffers.RenditionEntry";
+}
+
+
+// ===================================================================
+
+class HyperlinkEntry::_Internal {
+ public:
+  using HasBits = decltype(std::declval<HyperlinkEntry>()._impl_._has_bits_);
+  static void set_has_params(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_url(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+HyperlinkEntry::HyperlinkEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.HyperlinkEntry)
+}
+HyperlinkEntry::HyperlinkEntry(const HyperlinkEntry& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  HyperlinkEntry* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.params_){}
+    , decltype(_impl_.url_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.params_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.params_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_params()) {
+    _this->_impl_.params_.Set(from._internal_params(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_url()) {
+    _this->_impl_.url_.Set(from._internal_url(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.HyperlinkEntry)
+}
+
+inline void HyperlinkEntry::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.params_){}
+    , decltype(_impl_.url_){}
+  };
+  _impl_.params_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.params_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.url_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.url_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+HyperlinkEntry::~HyperlinkEntry() {
+  // @@protoc_insertion_point(destructor:HostBuffers.HyperlinkEntry)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HyperlinkEntry::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.params_.Destroy();
+  _impl_.url_.Destroy();
+}
+
+void HyperlinkEntry::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HyperlinkEntry::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.HyperlinkEntry)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.params_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.url_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* HyperlinkEntry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional bytes params = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_params();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes url = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_url();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HyperlinkEntry::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.HyperlinkEntry)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes params = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_params(), target);
+  }
+
+  // optional bytes url = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_url(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.HyperlinkEntry)
+  return target;
+}
+
+size_t HyperlinkEntry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.HyperlinkEntry)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes params = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_params());
+    }
+
+    // optional bytes url = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_url());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void HyperlinkEntry::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const HyperlinkEntry*>(
+      &from));
+}
+
+void HyperlinkEntry::MergeFrom(const HyperlinkEntry& from) {
+  HyperlinkEntry* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.HyperlinkEntry)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_params(from._internal_params());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_url(from._internal_url());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void HyperlinkEntry::CopyFrom(const HyperlinkEntry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.HyperlinkEntry)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HyperlinkEntry::IsInitialized() const {
+  return true;
+}
+
+void HyperlinkEntry::InternalSwap(HyperlinkEntry* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.params_, lhs_arena,
+      &other->_impl_.params_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.url_, lhs_arena,
+      &other->_impl_.url_, rhs_arena
+  );
+}
+
+std::string HyperlinkEntry::GetTypeName() const {
+  return "HostBuffers.HyperlinkEntry";
+}
+
+
+// ===================================================================
+
+class Text::_Internal {
+ public:
+};
+
+Text::Text(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.Text)
+}
+Text::Text(const Text& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Text* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.codepoint_){from._impl_.codepoint_}
+    , /*decltype(_impl_._codepoint_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.Text)
+}
+
+inline void Text::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.codepoint_){arena}
+    , /*decltype(_impl_._codepoint_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Text::~Text() {
+  // @@protoc_insertion_point(destructor:HostBuffers.Text)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Text::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.codepoint_.~RepeatedField();
+}
+
+void Text::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Text::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.Text)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.codepoint_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Text::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 codepoint = 1 [packed = true];
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_codepoint(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_codepoint(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Text::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.Text)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 codepoint = 1 [packed = true];
+  {
+    int byte_size = _impl_._codepoint_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_codepoint(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.Text)
+  return target;
+}
+
+size_t Text::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.Text)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 codepoint = 1 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.codepoint_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._codepoint_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Text::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Text*>(
+      &from));
+}
+
+void Text::MergeFrom(const Text& from) {
+  Text* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.Text)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.codepoint_.MergeFrom(from._impl_.codepoint_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Text::CopyFrom(const Text& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.Text)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Text::IsInitialized() const {
+  return true;
+}
+
+void Text::InternalSwap(Text* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.codepoint_.InternalSwap(&other->_impl_.codepoint_);
+}
+
+std::string Text::GetTypeName() const {
+  return "HostBuffers.Text";
+}
+
+
+// ===================================================================
+
+class FrameUpdate::_Internal {
+ public:
+  using HasBits = decltype(std::declval<FrameUpdate>()._impl_._has_bits_);
+  static void set_has_rows(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_cursor_row(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_cursor_col(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_cursor_visible(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_current_rendition(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_current_hyperlink(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_reverse_video(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_bracketed_paste(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_mouse_reporting_mode(HasBits* has_bits) {
+    (*has_bits)[0] |= 4096u;
+  }
+  static void set_has_mouse_focus_event(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_mouse_alternate_scroll(HasBits* has_bits) {
+    (*has_bits)[0] |= 16384u;
+  }
+  static void set_has_mouse_encoding_mode(HasBits* has_bits) {
+    (*has_bits)[0] |= 8192u;
+  }
+  static void set_has_title_initialized(HasBits* has_bits) {
+    (*has_bits)[0] |= 32768u;
+  }
+  static const ::HostBuffers::Text& icon_name(const FrameUpdate* msg);
+  static void set_has_icon_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::HostBuffers::Text& window_title(const FrameUpdate* msg);
+  static void set_has_window_title(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::HostBuffers::Text& clipboard(const FrameUpdate* msg);
+  static void set_has_clipboard(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_bell_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 65536u;
+  }
+};
+
+const ::HostBuffers::Text&
+FrameUpdate::_Internal::icon_name(const FrameUpdate* msg) {
+  return *msg->_impl_.icon_name_;
+}
+const ::HostBuffers::Text&
+FrameUpdate::_Internal::window_title(const FrameUpdate* msg) {
+  return *msg->_impl_.window_title_;
+}
+const ::HostBuffers::Text&
+FrameUpdate::_Internal::clipboard(const FrameUpdate* msg) {
+  return *msg->_impl_.clipboard_;
+}
+FrameUpdate::FrameUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:HostBuffers.FrameUpdate)
+}
+FrameUpdate::FrameUpdate(const FrameUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  FrameUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rendition_table_){from._impl_.rendition_table_}
+    , decltype(_impl_.hyperlink_table_){from._impl_.hyperlink_table_}
+    , decltype(_impl_.rows_){}
+    , decltype(_impl_.icon_name_){nullptr}
+    , decltype(_impl_.window_title_){nullptr}
+    , decltype(_impl_.clipboard_){nullptr}
+    , decltype(_impl_.cursor_row_){}
+    , decltype(_impl_.cursor_col_){}
+    , decltype(_impl_.current_rendition_){}
+    , decltype(_impl_.current_hyperlink_){}
+    , decltype(_impl_.cursor_visible_){}
+    , decltype(_impl_.reverse_video_){}
+    , decltype(_impl_.bracketed_paste_){}
+    , decltype(_impl_.mouse_focus_event_){}
+    , decltype(_impl_.mouse_reporting_mode_){}
+    , decltype(_impl_.mouse_encoding_mode_){}
+    , decltype(_impl_.mouse_alternate_scroll_){}
+    , decltype(_impl_.title_initialized_){}
+    , decltype(_impl_.bell_count_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.rows_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rows_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_rows()) {
+    _this->_impl_.rows_.Set(from._internal_rows(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_icon_name()) {
+    _this->_impl_.icon_name_ = new ::HostBuffers::Text(*from._impl_.icon_name_);
+  }
+  if (from._internal_has_window_title()) {
+    _this->_impl_.window_title_ = new ::HostBuffers::Text(*from._impl_.window_title_);
+  }
+  if (from._internal_has_clipboard()) {
+    _this->_impl_.clipboard_ = new ::HostBuffers::Text(*from._impl_.clipboard_);
+  }
+  ::memcpy(&_impl_.cursor_row_, &from._impl_.cursor_row_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bell_count_) -
+    reinterpret_cast<char*>(&_impl_.cursor_row_)) + sizeof(_impl_.bell_count_));
+  // @@protoc_insertion_point(copy_constructor:HostBuffers.FrameUpdate)
+}
+
+inline void FrameUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rendition_table_){arena}
+    , decltype(_impl_.hyperlink_table_){arena}
+    , decltype(_impl_.rows_){}
+    , decltype(_impl_.icon_name_){nullptr}
+    , decltype(_impl_.window_title_){nullptr}
+    , decltype(_impl_.clipboard_){nullptr}
+    , decltype(_impl_.cursor_row_){0u}
+    , decltype(_impl_.cursor_col_){0u}
+    , decltype(_impl_.current_rendition_){0u}
+    , decltype(_impl_.current_hyperlink_){0u}
+    , decltype(_impl_.cursor_visible_){false}
+    , decltype(_impl_.reverse_video_){false}
+    , decltype(_impl_.bracketed_paste_){false}
+    , decltype(_impl_.mouse_focus_event_){false}
+    , decltype(_impl_.mouse_reporting_mode_){0u}
+    , decltype(_impl_.mouse_encoding_mode_){0u}
+    , decltype(_impl_.mouse_alternate_scroll_){false}
+    , decltype(_impl_.title_initialized_){false}
+    , decltype(_impl_.bell_count_){0u}
+  };
+  _impl_.rows_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.rows_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FrameUpdate::~FrameUpdate() {
+  // @@protoc_insertion_point(destructor:HostBuffers.FrameUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FrameUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rendition_table_.~RepeatedPtrField();
+  _impl_.hyperlink_table_.~RepeatedPtrField();
+  _impl_.rows_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.icon_name_;
+  if (this != internal_default_instance()) delete _impl_.window_title_;
+  if (this != internal_default_instance()) delete _impl_.clipboard_;
+}
+
+void FrameUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FrameUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:HostBuffers.FrameUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.rendition_table_.Clear();
+  _impl_.hyperlink_table_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.rows_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.icon_name_ != nullptr);
+      _impl_.icon_name_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.window_title_ != nullptr);
+      _impl_.window_title_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.clipboard_ != nullptr);
+      _impl_.clipboard_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x000000f0u) {
+    ::memset(&_impl_.cursor_row_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.current_hyperlink_) -
+        reinterpret_cast<char*>(&_impl_.cursor_row_)) + sizeof(_impl_.current_hyperlink_));
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    ::memset(&_impl_.cursor_visible_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.title_initialized_) -
+        reinterpret_cast<char*>(&_impl_.cursor_visible_)) + sizeof(_impl_.title_initialized_));
+  }
+  _impl_.bell_count_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* FrameUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .HostBuffers.RenditionEntry rendition_table = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rendition_table(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .HostBuffers.HyperlinkEntry hyperlink_table = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_hyperlink_table(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes rows = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_rows();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 cursor_row = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_cursor_row(&has_bits);
+          _impl_.cursor_row_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 cursor_col = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_cursor_col(&has_bits);
+          _impl_.cursor_col_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool cursor_visible = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_cursor_visible(&has_bits);
+          _impl_.cursor_visible_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 current_rendition = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_current_rendition(&has_bits);
+          _impl_.current_rendition_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 current_hyperlink = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_current_hyperlink(&has_bits);
+          _impl_.current_hyperlink_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool reverse_video = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_reverse_video(&has_bits);
+          _impl_.reverse_video_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool bracketed_paste = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _Internal::set_has_bracketed_paste(&has_bits);
+          _impl_.bracketed_paste_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 mouse_reporting_mode = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _Internal::set_has_mouse_reporting_mode(&has_bits);
+          _impl_.mouse_reporting_mode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool mouse_focus_event = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _Internal::set_has_mouse_focus_event(&has_bits);
+          _impl_.mouse_focus_event_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool mouse_alternate_scroll = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _Internal::set_has_mouse_alternate_scroll(&has_bits);
+          _impl_.mouse_alternate_scroll_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 mouse_encoding_mode = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _Internal::set_has_mouse_encoding_mode(&has_bits);
+          _impl_.mouse_encoding_mode_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool title_initialized = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _Internal::set_has_title_initialized(&has_bits);
+          _impl_.title_initialized_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HostBuffers.Text icon_name = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
+          ptr = ctx->ParseMessage(_internal_mutable_icon_name(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HostBuffers.Text window_title = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 138)) {
+          ptr = ctx->ParseMessage(_internal_mutable_window_title(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .HostBuffers.Text clipboard = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 146)) {
+          ptr = ctx->ParseMessage(_internal_mutable_clipboard(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 bell_count = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _Internal::set_has_bell_count(&has_bits);
+          _impl_.bell_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FrameUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:HostBuffers.FrameUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .HostBuffers.RenditionEntry rendition_table = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rendition_table_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rendition_table(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .HostBuffers.HyperlinkEntry hyperlink_table = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_hyperlink_table_size()); i < n; i++) {
+    const auto& repfield = this->_internal_hyperlink_table(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional bytes rows = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_rows(), target);
+  }
+
+  // optional uint32 cursor_row = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_cursor_row(), target);
+  }
+
+  // optional uint32 cursor_col = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_cursor_col(), target);
+  }
+
+  // optional bool cursor_visible = 6;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(6, this->_internal_cursor_visible(), target);
+  }
+
+  // optional uint32 current_rendition = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_current_rendition(), target);
+  }
+
+  // optional uint32 current_hyperlink = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_current_hyperlink(), target);
+  }
+
+  // optional bool reverse_video = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(9, this->_internal_reverse_video(), target);
+  }
+
+  // optional bool bracketed_paste = 10;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(10, this->_internal_bracketed_paste(), target);
+  }
+
+  // optional uint32 mouse_reporting_mode = 11;
+  if (cached_has_bits & 0x00001000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(11, this->_internal_mouse_reporting_mode(), target);
+  }
+
+  // optional bool mouse_focus_event = 12;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(12, this->_internal_mouse_focus_event(), target);
+  }
+
+  // optional bool mouse_alternate_scroll = 13;
+  if (cached_has_bits & 0x00004000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(13, this->_internal_mouse_alternate_scroll(), target);
+  }
+
+  // optional uint32 mouse_encoding_mode = 14;
+  if (cached_has_bits & 0x00002000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(14, this->_internal_mouse_encoding_mode(), target);
+  }
+
+  // optional bool title_initialized = 15;
+  if (cached_has_bits & 0x00008000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(15, this->_internal_title_initialized(), target);
+  }
+
+  // optional .HostBuffers.Text icon_name = 16;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(16, _Internal::icon_name(this),
+        _Internal::icon_name(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .HostBuffers.Text window_title = 17;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(17, _Internal::window_title(this),
+        _Internal::window_title(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .HostBuffers.Text clipboard = 18;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(18, _Internal::clipboard(this),
+        _Internal::clipboard(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 bell_count = 19;
+  if (cached_has_bits & 0x00010000u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(19, this->_internal_bell_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:HostBuffers.FrameUpdate)
+  return target;
+}
+
+size_t FrameUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:HostBuffers.FrameUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .HostBuffers.RenditionEntry rendition_table = 1;
+  total_size += 1UL * this->_internal_rendition_table_size();
+  for (const auto& msg : this->_impl_.rendition_table_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .HostBuffers.HyperlinkEntry hyperlink_table = 2;
+  total_size += 1UL * this->_internal_hyperlink_table_size();
+  for (const auto& msg : this->_impl_.hyperlink_table_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional bytes rows = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_rows());
+    }
+
+    // optional .HostBuffers.Text icon_name = 16;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.icon_name_);
+    }
+
+    // optional .HostBuffers.Text window_title = 17;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.window_title_);
+    }
+
+    // optional .HostBuffers.Text clipboard = 18;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 2 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.clipboard_);
+    }
+
+    // optional uint32 cursor_row = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cursor_row());
+    }
+
+    // optional uint32 cursor_col = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_cursor_col());
+    }
+
+    // optional uint32 current_rendition = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_current_rendition());
+    }
+
+    // optional uint32 current_hyperlink = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_current_hyperlink());
+    }
+
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    // optional bool cursor_visible = 6;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool reverse_video = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool bracketed_paste = 10;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool mouse_focus_event = 12;
+    if (cached_has_bits & 0x00000800u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 mouse_reporting_mode = 11;
+    if (cached_has_bits & 0x00001000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mouse_reporting_mode());
+    }
+
+    // optional uint32 mouse_encoding_mode = 14;
+    if (cached_has_bits & 0x00002000u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_mouse_encoding_mode());
+    }
+
+    // optional bool mouse_alternate_scroll = 13;
+    if (cached_has_bits & 0x00004000u) {
+      total_size += 1 + 1;
+    }
+
+    // optional bool title_initialized = 15;
+    if (cached_has_bits & 0x00008000u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  // optional uint32 bell_count = 19;
+  if (cached_has_bits & 0x00010000u) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt32Size(
+        this->_internal_bell_count());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void FrameUpdate::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const FrameUpdate*>(
+      &from));
+}
+
+void FrameUpdate::MergeFrom(const FrameUpdate& from) {
+  FrameUpdate* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:HostBuffers.FrameUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.rendition_table_.MergeFrom(from._impl_.rendition_table_);
+  _this->_impl_.hyperlink_table_.MergeFrom(from._impl_.hyperlink_table_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_rows(from._internal_rows());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_icon_name()->::HostBuffers::Text::MergeFrom(
+          from._internal_icon_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_window_title()->::HostBuffers::Text::MergeFrom(
+          from._internal_window_title());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_clipboard()->::HostBuffers::Text::MergeFrom(
+          from._internal_clipboard());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.cursor_row_ = from._impl_.cursor_row_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.cursor_col_ = from._impl_.cursor_col_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.current_rendition_ = from._impl_.current_rendition_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.current_hyperlink_ = from._impl_.current_hyperlink_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x0000ff00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.cursor_visible_ = from._impl_.cursor_visible_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.reverse_video_ = from._impl_.reverse_video_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.bracketed_paste_ = from._impl_.bracketed_paste_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.mouse_focus_event_ = from._impl_.mouse_focus_event_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      _this->_impl_.mouse_reporting_mode_ = from._impl_.mouse_reporting_mode_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      _this->_impl_.mouse_encoding_mode_ = from._impl_.mouse_encoding_mode_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      _this->_impl_.mouse_alternate_scroll_ = from._impl_.mouse_alternate_scroll_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      _this->_impl_.title_initialized_ = from._impl_.title_initialized_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00010000u) {
+    _this->_internal_set_bell_count(from._internal_bell_count());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void FrameUpdate::CopyFrom(const FrameUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:HostBuffers.FrameUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FrameUpdate::IsInitialized() const {
+  return true;
+}
+
+void FrameUpdate::InternalSwap(FrameUpdate* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.rendition_table_.InternalSwap(&other->_impl_.rendition_table_);
+  _impl_.hyperlink_table_.InternalSwap(&other->_impl_.hyperlink_table_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.rows_, lhs_arena,
+      &other->_impl_.rows_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FrameUpdate, _impl_.bell_count_)
+      + sizeof(FrameUpdate::_impl_.bell_count_)
+      - PROTOBUF_FIELD_OFFSET(FrameUpdate, _impl_.icon_name_)>(
+          reinterpret_cast<char*>(&_impl_.icon_name_),
+          reinterpret_cast<char*>(&other->_impl_.icon_name_));
+}
+
+std::string FrameUpdate::GetTypeName() const {
+  return "HostBuffers.FrameUpdate";
+}
+
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::HostBytes >, 11, false>
+  hostbytes(kHostbytesFieldNumber, ::HostBuffers::HostBytes::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::ResizeMessage >, 11, false>
+  resize(kResizeFieldNumber, ::HostBuffers::ResizeMessage::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::EchoAck >, 11, false>
+  echoack(kEchoackFieldNumber, ::HostBuffers::EchoAck::default_instance(), nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::FrameUpdate >, 11, false>
+  frameupdate(kFrameupdateFieldNumber, ::HostBuffers::FrameUpdate::default_instance(), nullptr);
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace HostBuffers
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::HostBuffers::HostMessage*
+Arena::CreateMaybeMessage< ::HostBuffers::HostMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::HostMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::Instruction*
+Arena::CreateMaybeMessage< ::HostBuffers::Instruction >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::Instruction >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::HostBytes*
+Arena::CreateMaybeMessage< ::HostBuffers::HostBytes >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::HostBytes >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::ResizeMessage*
+Arena::CreateMaybeMessage< ::HostBuffers::ResizeMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::ResizeMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::EchoAck*
+Arena::CreateMaybeMessage< ::HostBuffers::EchoAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::EchoAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::RenditionEntry*
+Arena::CreateMaybeMessage< ::HostBuffers::RenditionEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::RenditionEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::HyperlinkEntry*
+Arena::CreateMaybeMessage< ::HostBuffers::HyperlinkEntry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::HyperlinkEntry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::Text*
+Arena::CreateMaybeMessage< ::HostBuffers::Text >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::Text >(arena);
+}
+template<> PROTOBUF_NOINLINE ::HostBuffers::FrameUpdate*
+Arena::CreateMaybeMessage< ::HostBuffers::FrameUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::HostBuffers::FrameUpdate >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,3253 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: hostinput.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_hostinput_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_hostinput_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_hostinput_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_hostinput_2eproto {
+  static const uint32_t offsets[];
+};
+namespace HostBuffers {
+class EchoAck;
+struct EchoAckDefaultTypeInternal;
+extern EchoAckDefaultTypeInternal _EchoAck_default_instance_;
+class FrameUpdate;
+struct FrameUpdateDefaultTypeInternal;
+extern FrameUpdateDefaultTypeInternal _FrameUpdate_default_instance_;
+class HostBytes;
+struct HostBytesDefaultTypeInternal;
+extern HostBytesDefaultTypeInternal _HostBytes_default_instance_;
+class HostMessage;
+struct HostMessageDefaultTypeInternal;
+extern HostMessageDefaultTypeInternal _HostMessage_default_instance_;
+class HyperlinkEntry;
+struct HyperlinkEntryDefaultTypeInternal;
+extern HyperlinkEntryDefaultTypeInternal _HyperlinkEntry_default_instance_;
+class Instruction;
+struct InstructionDefaultTypeInternal;
+extern InstructionDefaultTypeInternal _Instruction_default_instance_;
+class RenditionEntry;
+struct RenditionEntryDefaultTypeInternal;
+extern RenditionEntryDefaultTypeInternal _RenditionEntry_default_instance_;
+class ResizeMessage;
+struct ResizeMessageDefaultTypeInternal;
+extern ResizeMessageDefaultTypeInternal _ResizeMessage_default_instance_;
+class Text;
+struct TextDefaultTypeInternal;
+extern TextDefaultTypeInternal _Text_default_instance_;
+}  // namespace HostBuffers
+PROTOBUF_NAMESPACE_OPEN
+template<> ::HostBuffers::EchoAck* Arena::CreateMaybeMessage<::HostBuffers::EchoAck>(Arena*);
+template<> ::HostBuffers::FrameUpdate* Arena::CreateMaybeMessage<::HostBuffers::FrameUpdate>(Arena*);
+template<> ::HostBuffers::HostBytes* Arena::CreateMaybeMessage<::HostBuffers::HostBytes>(Arena*);
+template<> ::HostBuffers::HostMessage* Arena::CreateMaybeMessage<::HostBuffers::HostMessage>(Arena*);
+template<> ::HostBuffers::HyperlinkEntry* Arena::CreateMaybeMessage<::HostBuffers::HyperlinkEntry>(Arena*);
+template<> ::HostBuffers::Instruction* Arena::CreateMaybeMessage<::HostBuffers::Instruction>(Arena*);
+template<> ::HostBuffers::RenditionEntry* Arena::CreateMaybeMessage<::HostBuffers::RenditionEntry>(Arena*);
+template<> ::HostBuffers::ResizeMessage* Arena::CreateMaybeMessage<::HostBuffers::ResizeMessage>(Arena*);
+template<> ::HostBuffers::Text* Arena::CreateMaybeMessage<::HostBuffers::Text>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace HostBuffers {
+
+// ===================================================================
+
+class HostMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.HostMessage) */ {
+ public:
+  inline HostMessage() : HostMessage(nullptr) {}
+  ~HostMessage() override;
+  explicit PROTOBUF_CONSTEXPR HostMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HostMessage(const HostMessage& from);
+  HostMessage(HostMessage&& from) noexcept
+    : HostMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline HostMessage& operator=(const HostMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HostMessage& operator=(HostMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HostMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HostMessage* internal_default_instance() {
+    return reinterpret_cast<const HostMessage*>(
+               &_HostMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(HostMessage& a, HostMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HostMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HostMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HostMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HostMessage>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HostMessage& from);
+  void MergeFrom(const HostMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HostMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.HostMessage";
+  }
+  protected:
+  explicit HostMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInstructionFieldNumber = 1,
+  };
+  // repeated .HostBuffers.Instruction instruction = 1;
+  int instruction_size() const;
+  private:
+  int _internal_instruction_size() const;
+  public:
+  void clear_instruction();
+  ::HostBuffers::Instruction* mutable_instruction(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::Instruction >*
+      mutable_instruction();
+  private:
+  const ::HostBuffers::Instruction& _internal_instruction(int index) const;
+  ::HostBuffers::Instruction* _internal_add_instruction();
+  public:
+  const ::HostBuffers::Instruction& instruction(int index) const;
+  ::HostBuffers::Instruction* add_instruction();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::Instruction >&
+      instruction() const;
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.HostMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::Instruction > instruction_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Instruction final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.Instruction) */ {
+ public:
+  inline Instruction() : Instruction(nullptr) {}
+  ~Instruction() override;
+  explicit PROTOBUF_CONSTEXPR Instruction(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Instruction(const Instruction& from);
+  Instruction(Instruction&& from) noexcept
+    : Instruction() {
+    *this = ::std::move(from);
+  }
+
+  inline Instruction& operator=(const Instruction& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Instruction& operator=(Instruction&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Instruction& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Instruction* internal_default_instance() {
+    return reinterpret_cast<const Instruction*>(
+               &_Instruction_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Instruction& a, Instruction& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Instruction* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Instruction* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Instruction* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Instruction>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Instruction& from);
+  void MergeFrom(const Instruction& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Instruction* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.Instruction";
+  }
+  protected:
+  explicit Instruction(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline bool HasExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.Has(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void ClearExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    _impl_._extensions_.ClearExtension(id.number());
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline int ExtensionSize(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _impl_._extensions_.ExtensionSize(id.number());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_,
+                                  id.default_value());
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Mutable(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), _field_type, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::SetAllocated(id.number(), _field_type, value,
+                                    &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void UnsafeArenaSetAllocatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Singular::MutableType value) {
+    _proto_TypeTraits::UnsafeArenaSetAllocated(id.number(), _field_type,
+                                               value, &_impl_._extensions_);
+
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  PROTOBUF_NODISCARD inline
+      typename _proto_TypeTraits::Singular::MutableType
+      ReleaseExtension(
+          const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+              Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::Release(id.number(), _field_type,
+                                      &_impl_._extensions_);
+  }
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Singular::MutableType
+  UnsafeArenaReleaseExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::UnsafeArenaRelease(id.number(), _field_type,
+                                                 &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::ConstType GetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) const {
+
+    return _proto_TypeTraits::Get(id.number(), _impl_._extensions_, index);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType MutableExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index) {
+
+    return _proto_TypeTraits::Mutable(id.number(), index, &_impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void SetExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      int index, typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Set(id.number(), index, value, &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::MutableType AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) {
+    typename _proto_TypeTraits::Repeated::MutableType to_add =
+        _proto_TypeTraits::Add(id.number(), _field_type, &_impl_._extensions_);
+
+    return to_add;
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline void AddExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id,
+      typename _proto_TypeTraits::Repeated::ConstType value) {
+    _proto_TypeTraits::Add(id.number(), _field_type, _is_packed, value,
+                           &_impl_._extensions_);
+
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline const typename _proto_TypeTraits::Repeated::RepeatedFieldType&
+  GetRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) const {
+
+    return _proto_TypeTraits::GetRepeated(id.number(), _impl_._extensions_);
+  }
+
+  template <typename _proto_TypeTraits,
+            ::PROTOBUF_NAMESPACE_ID::internal::FieldType _field_type,
+            bool _is_packed>
+  inline typename _proto_TypeTraits::Repeated::RepeatedFieldType*
+  MutableRepeatedExtension(
+      const ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier<
+          Instruction, _proto_TypeTraits, _field_type, _is_packed>& id) {
+
+    return _proto_TypeTraits::MutableRepeated(id.number(), _field_type,
+                                              _is_packed, &_impl_._extensions_);
+  }
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.Instruction)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ExtensionSet _extensions_;
+
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HostBytes final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.HostBytes) */ {
+ public:
+  inline HostBytes() : HostBytes(nullptr) {}
+  ~HostBytes() override;
+  explicit PROTOBUF_CONSTEXPR HostBytes(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HostBytes(const HostBytes& from);
+  HostBytes(HostBytes&& from) noexcept
+    : HostBytes() {
+    *this = ::std::move(from);
+  }
+
+  inline HostBytes& operator=(const HostBytes& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HostBytes& operator=(HostBytes&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HostBytes& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HostBytes* internal_default_instance() {
+    return reinterpret_cast<const HostBytes*>(
+               &_HostBytes_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(HostBytes& a, HostBytes& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HostBytes* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HostBytes* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HostBytes* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HostBytes>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HostBytes& from);
+  void MergeFrom(const HostBytes& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HostBytes* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.HostBytes";
+  }
+  protected:
+  explicit HostBytes(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHoststringFieldNumber = 4,
+  };
+  // optional bytes hoststring = 4;
+  bool has_hoststring() const;
+  private:
+  bool _internal_has_hoststring() const;
+  public:
+  void clear_hoststring();
+  const std::string& hoststring() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hoststring(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hoststring();
+  PROTOBUF_NODISCARD std::string* release_hoststring();
+  void set_allocated_hoststring(std::string* hoststring);
+  private:
+  const std::string& _internal_hoststring() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hoststring(const std::string& value);
+  std::string* _internal_mutable_hoststring();
+  public:
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.HostBytes)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hoststring_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResizeMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.ResizeMessage) */ {
+ public:
+  inline ResizeMessage() : ResizeMessage(nullptr) {}
+  ~ResizeMessage() override;
+  explicit PROTOBUF_CONSTEXPR ResizeMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResizeMessage(const ResizeMessage& from);
+  ResizeMessage(ResizeMessage&& from) noexcept
+    : ResizeMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline ResizeMessage& operator=(const ResizeMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResizeMessage& operator=(ResizeMessage&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ResizeMessage& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResizeMessage* internal_default_instance() {
+    return reinterpret_cast<const ResizeMessage*>(
+               &_ResizeMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(ResizeMessage& a, ResizeMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResizeMessage* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResizeMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResizeMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResizeMessage>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ResizeMessage& from);
+  void MergeFrom(const ResizeMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ResizeMessage* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.ResizeMessage";
+  }
+  protected:
+  explicit ResizeMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWidthFieldNumber = 5,
+    kHeightFieldNumber = 6,
+  };
+  // optional int32 width = 5;
+  bool has_width() const;
+  private:
+  bool _internal_has_width() const;
+  public:
+  void clear_width();
+  int32_t width() const;
+  void set_width(int32_t value);
+  private:
+  int32_t _internal_width() const;
+  void _internal_set_width(int32_t value);
+  public:
+
+  // optional int32 height = 6;
+  bool has_height() const;
+  private:
+  bool _internal_has_height() const;
+  public:
+  void clear_height();
+  int32_t height() const;
+  void set_height(int32_t value);
+  private:
+  int32_t _internal_height() const;
+  void _internal_set_height(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.ResizeMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    int32_t width_;
+    int32_t height_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EchoAck final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.EchoAck) */ {
+ public:
+  inline EchoAck() : EchoAck(nullptr) {}
+  ~EchoAck() override;
+  explicit PROTOBUF_CONSTEXPR EchoAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EchoAck(const EchoAck& from);
+  EchoAck(EchoAck&& from) noexcept
+    : EchoAck() {
+    *this = ::std::move(from);
+  }
+
+  inline EchoAck& operator=(const EchoAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EchoAck& operator=(EchoAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const EchoAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EchoAck* internal_default_instance() {
+    return reinterpret_cast<const EchoAck*>(
+               &_EchoAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(EchoAck& a, EchoAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EchoAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EchoAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EchoAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EchoAck>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const EchoAck& from);
+  void MergeFrom(const EchoAck& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(EchoAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.EchoAck";
+  }
+  protected:
+  explicit EchoAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEchoAckNumFieldNumber = 8,
+  };
+  // optional uint64 echo_ack_num = 8;
+  bool has_echo_ack_num() const;
+  private:
+  bool _internal_has_echo_ack_num() const;
+  public:
+  void clear_echo_ack_num();
+  uint64_t echo_ack_num() const;
+  void set_echo_ack_num(uint64_t value);
+  private:
+  uint64_t _internal_echo_ack_num() const;
+  void _internal_set_echo_ack_num(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.EchoAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint64_t echo_ack_num_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RenditionEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.RenditionEntry) */ {
+ public:
+  inline RenditionEntry() : RenditionEntry(nullptr) {}
+  ~RenditionEntry() override;
+  explicit PROTOBUF_CONSTEXPR RenditionEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RenditionEntry(const RenditionEntry& from);
+  RenditionEntry(RenditionEntry&& from) noexcept
+    : RenditionEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline RenditionEntry& operator=(const RenditionEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RenditionEntry& operator=(RenditionEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const RenditionEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RenditionEntry* internal_default_instance() {
+    return reinterpret_cast<const RenditionEntry*>(
+               &_RenditionEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(RenditionEntry& a, RenditionEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RenditionEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RenditionEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RenditionEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RenditionEntry>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const RenditionEntry& from);
+  void MergeFrom(const RenditionEntry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(RenditionEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.RenditionEntry";
+  }
+  protected:
+  explicit RenditionEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kForegroundFieldNumber = 1,
+    kBackgroundFieldNumber = 2,
+    kAttributesFieldNumber = 3,
+  };
+  // optional uint32 foreground = 1;
+  bool has_foreground() const;
+  private:
+  bool _internal_has_foreground() const;
+  public:
+  void clear_foreground();
+  uint32_t foreground() const;
+  void set_foreground(uint32_t value);
+  private:
+  uint32_t _internal_foreground() const;
+  void _internal_set_foreground(uint32_t value);
+  public:
+
+  // optional uint32 background = 2;
+  bool has_background() const;
+  private:
+  bool _internal_has_background() const;
+  public:
+  void clear_background();
+  uint32_t background() const;
+  void set_background(uint32_t value);
+  private:
+  uint32_t _internal_background() const;
+  void _internal_set_background(uint32_t value);
+  public:
+
+  // optional uint32 attributes = 3;
+  bool has_attributes() const;
+  private:
+  bool _internal_has_attributes() const;
+  public:
+  void clear_attributes();
+  uint32_t attributes() const;
+  void set_attributes(uint32_t value);
+  private:
+  uint32_t _internal_attributes() const;
+  void _internal_set_attributes(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.RenditionEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t foreground_;
+    uint32_t background_;
+    uint32_t attributes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HyperlinkEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.HyperlinkEntry) */ {
+ public:
+  inline HyperlinkEntry() : HyperlinkEntry(nullptr) {}
+  ~HyperlinkEntry() override;
+  explicit PROTOBUF_CONSTEXPR HyperlinkEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HyperlinkEntry(const HyperlinkEntry& from);
+  HyperlinkEntry(HyperlinkEntry&& from) noexcept
+    : HyperlinkEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline HyperlinkEntry& operator=(const HyperlinkEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HyperlinkEntry& operator=(HyperlinkEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HyperlinkEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HyperlinkEntry* internal_default_instance() {
+    return reinterpret_cast<const HyperlinkEntry*>(
+               &_HyperlinkEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(HyperlinkEntry& a, HyperlinkEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HyperlinkEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HyperlinkEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HyperlinkEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HyperlinkEntry>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HyperlinkEntry& from);
+  void MergeFrom(const HyperlinkEntry& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HyperlinkEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.HyperlinkEntry";
+  }
+  protected:
+  explicit HyperlinkEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kParamsFieldNumber = 1,
+    kUrlFieldNumber = 2,
+  };
+  // optional bytes params = 1;
+  bool has_params() const;
+  private:
+  bool _internal_has_params() const;
+  public:
+  void clear_params();
+  const std::string& params() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_params(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_params();
+  PROTOBUF_NODISCARD std::string* release_params();
+  void set_allocated_params(std::string* params);
+  private:
+  const std::string& _internal_params() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_params(const std::string& value);
+  std::string* _internal_mutable_params();
+  public:
+
+  // optional bytes url = 2;
+  bool has_url() const;
+  private:
+  bool _internal_has_url() const;
+  public:
+  void clear_url();
+  const std::string& url() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_url(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_url();
+  PROTOBUF_NODISCARD std::string* release_url();
+  void set_allocated_url(std::string* url);
+  private:
+  const std::string& _internal_url() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_url(const std::string& value);
+  std::string* _internal_mutable_url();
+  public:
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.HyperlinkEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr params_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr url_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Text final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.Text) */ {
+ public:
+  inline Text() : Text(nullptr) {}
+  ~Text() override;
+  explicit PROTOBUF_CONSTEXPR Text(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Text(const Text& from);
+  Text(Text&& from) noexcept
+    : Text() {
+    *this = ::std::move(from);
+  }
+
+  inline Text& operator=(const Text& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Text& operator=(Text&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Text& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Text* internal_default_instance() {
+    return reinterpret_cast<const Text*>(
+               &_Text_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Text& a, Text& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Text* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Text* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Text* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Text>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Text& from);
+  void MergeFrom(const Text& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Text* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.Text";
+  }
+  protected:
+  explicit Text(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCodepointFieldNumber = 1,
+  };
+  // repeated uint32 codepoint = 1 [packed = true];
+  int codepoint_size() const;
+  private:
+  int _internal_codepoint_size() const;
+  public:
+  void clear_codepoint();
+  private:
+  uint32_t _internal_codepoint(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_codepoint() const;
+  void _internal_add_codepoint(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_codepoint();
+  public:
+  uint32_t codepoint(int index) const;
+  void set_codepoint(int index, uint32_t value);
+  void add_codepoint(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      codepoint() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_codepoint();
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.Text)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > codepoint_;
+    mutable std::atomic<int> _codepoint_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FrameUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:HostBuffers.FrameUpdate) */ {
+ public:
+  inline FrameUpdate() : FrameUpdate(nullptr) {}
+  ~FrameUpdate() override;
+  explicit PROTOBUF_CONSTEXPR FrameUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FrameUpdate(const FrameUpdate& from);
+  FrameUpdate(FrameUpdate&& from) noexcept
+    : FrameUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline FrameUpdate& operator=(const FrameUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FrameUpdate& operator=(FrameUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const FrameUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FrameUpdate* internal_default_instance() {
+    return reinterpret_cast<const FrameUpdate*>(
+               &_FrameUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(FrameUpdate& a, FrameUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FrameUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FrameUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FrameUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FrameUpdate>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const FrameUpdate& from);
+  void MergeFrom(const FrameUpdate& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(FrameUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "HostBuffers.FrameUpdate";
+  }
+  protected:
+  explicit FrameUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRenditionTableFieldNumber = 1,
+    kHyperlinkTableFieldNumber = 2,
+    kRowsFieldNumber = 3,
+    kIconNameFieldNumber = 16,
+    kWindowTitleFieldNumber = 17,
+    kClipboardFieldNumber = 18,
+    kCursorRowFieldNumber = 4,
+    kCursorColFieldNumber = 5,
+    kCurrentRenditionFieldNumber = 7,
+    kCurrentHyperlinkFieldNumber = 8,
+    kCursorVisibleFieldNumber = 6,
+    kReverseVideoFieldNumber = 9,
+    kBracketedPasteFieldNumber = 10,
+    kMouseFocusEventFieldNumber = 12,
+    kMouseReportingModeFieldNumber = 11,
+    kMouseEncodingModeFieldNumber = 14,
+    kMouseAlternateScrollFieldNumber = 13,
+    kTitleInitializedFieldNumber = 15,
+    kBellCountFieldNumber = 19,
+  };
+  // repeated .HostBuffers.RenditionEntry rendition_table = 1;
+  int rendition_table_size() const;
+  private:
+  int _internal_rendition_table_size() const;
+  public:
+  void clear_rendition_table();
+  ::HostBuffers::RenditionEntry* mutable_rendition_table(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::RenditionEntry >*
+      mutable_rendition_table();
+  private:
+  const ::HostBuffers::RenditionEntry& _internal_rendition_table(int index) const;
+  ::HostBuffers::RenditionEntry* _internal_add_rendition_table();
+  public:
+  const ::HostBuffers::RenditionEntry& rendition_table(int index) const;
+  ::HostBuffers::RenditionEntry* add_rendition_table();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::RenditionEntry >&
+      rendition_table() const;
+
+  // repeated .HostBuffers.HyperlinkEntry hyperlink_table = 2;
+  int hyperlink_table_size() const;
+  private:
+  int _internal_hyperlink_table_size() const;
+  public:
+  void clear_hyperlink_table();
+  ::HostBuffers::HyperlinkEntry* mutable_hyperlink_table(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::HyperlinkEntry >*
+      mutable_hyperlink_table();
+  private:
+  const ::HostBuffers::HyperlinkEntry& _internal_hyperlink_table(int index) const;
+  ::HostBuffers::HyperlinkEntry* _internal_add_hyperlink_table();
+  public:
+  const ::HostBuffers::HyperlinkEntry& hyperlink_table(int index) const;
+  ::HostBuffers::HyperlinkEntry* add_hyperlink_table();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::HyperlinkEntry >&
+      hyperlink_table() const;
+
+  // optional bytes rows = 3;
+  bool has_rows() const;
+  private:
+  bool _internal_has_rows() const;
+  public:
+  void clear_rows();
+  const std::string& rows() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_rows(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_rows();
+  PROTOBUF_NODISCARD std::string* release_rows();
+  void set_allocated_rows(std::string* rows);
+  private:
+  const std::string& _internal_rows() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_rows(const std::string& value);
+  std::string* _internal_mutable_rows();
+  public:
+
+  // optional .HostBuffers.Text icon_name = 16;
+  bool has_icon_name() const;
+  private:
+  bool _internal_has_icon_name() const;
+  public:
+  void clear_icon_name();
+  const ::HostBuffers::Text& icon_name() const;
+  PROTOBUF_NODISCARD ::HostBuffers::Text* release_icon_name();
+  ::HostBuffers::Text* mutable_icon_name();
+  void set_allocated_icon_name(::HostBuffers::Text* icon_name);
+  private:
+  const ::HostBuffers::Text& _internal_icon_name() const;
+  ::HostBuffers::Text* _internal_mutable_icon_name();
+  public:
+  void unsafe_arena_set_allocated_icon_name(
+      ::HostBuffers::Text* icon_name);
+  ::HostBuffers::Text* unsafe_arena_release_icon_name();
+
+  // optional .HostBuffers.Text window_title = 17;
+  bool has_window_title() const;
+  private:
+  bool _internal_has_window_title() const;
+  public:
+  void clear_window_title();
+  const ::HostBuffers::Text& window_title() const;
+  PROTOBUF_NODISCARD ::HostBuffers::Text* release_window_title();
+  ::HostBuffers::Text* mutable_window_title();
+  void set_allocated_window_title(::HostBuffers::Text* window_title);
+  private:
+  const ::HostBuffers::Text& _internal_window_title() const;
+  ::HostBuffers::Text* _internal_mutable_window_title();
+  public:
+  void unsafe_arena_set_allocated_window_title(
+      ::HostBuffers::Text* window_title);
+  ::HostBuffers::Text* unsafe_arena_release_window_title();
+
+  // optional .HostBuffers.Text clipboard = 18;
+  bool has_clipboard() const;
+  private:
+  bool _internal_has_clipboard() const;
+  public:
+  void clear_clipboard();
+  const ::HostBuffers::Text& clipboard() const;
+  PROTOBUF_NODISCARD ::HostBuffers::Text* release_clipboard();
+  ::HostBuffers::Text* mutable_clipboard();
+  void set_allocated_clipboard(::HostBuffers::Text* clipboard);
+  private:
+  const ::HostBuffers::Text& _internal_clipboard() const;
+  ::HostBuffers::Text* _internal_mutable_clipboard();
+  public:
+  void unsafe_arena_set_allocated_clipboard(
+      ::HostBuffers::Text* clipboard);
+  ::HostBuffers::Text* unsafe_arena_release_clipboard();
+
+  // optional uint32 cursor_row = 4;
+  bool has_cursor_row() const;
+  private:
+  bool _internal_has_cursor_row() const;
+  public:
+  void clear_cursor_row();
+  uint32_t cursor_row() const;
+  void set_cursor_row(uint32_t value);
+  private:
+  uint32_t _internal_cursor_row() const;
+  void _internal_set_cursor_row(uint32_t value);
+  public:
+
+  // optional uint32 cursor_col = 5;
+  bool has_cursor_col() const;
+  private:
+  bool _internal_has_cursor_col() const;
+  public:
+  void clear_cursor_col();
+  uint32_t cursor_col() const;
+  void set_cursor_col(uint32_t value);
+  private:
+  uint32_t _internal_cursor_col() const;
+  void _internal_set_cursor_col(uint32_t value);
+  public:
+
+  // optional uint32 current_rendition = 7;
+  bool has_current_rendition() const;
+  private:
+  bool _internal_has_current_rendition() const;
+  public:
+  void clear_current_rendition();
+  uint32_t current_rendition() const;
+  void set_current_rendition(uint32_t value);
+  private:
+  uint32_t _internal_current_rendition() const;
+  void _internal_set_current_rendition(uint32_t value);
+  public:
+
+  // optional uint32 current_hyperlink = 8;
+  bool has_current_hyperlink() const;
+  private:
+  bool _internal_has_current_hyperlink() const;
+  public:
+  void clear_current_hyperlink();
+  uint32_t current_hyperlink() const;
+  void set_current_hyperlink(uint32_t value);
+  private:
+  uint32_t _internal_current_hyperlink() const;
+  void _internal_set_current_hyperlink(uint32_t value);
+  public:
+
+  // optional bool cursor_visible = 6;
+  bool has_cursor_visible() const;
+  private:
+  bool _internal_has_cursor_visible() const;
+  public:
+  void clear_cursor_visible();
+  bool cursor_visible() const;
+  void set_cursor_visible(bool value);
+  private:
+  bool _internal_cursor_visible() const;
+  void _internal_set_cursor_visible(bool value);
+  public:
+
+  // optional bool reverse_video = 9;
+  bool has_reverse_video() const;
+  private:
+  bool _internal_has_reverse_video() const;
+  public:
+  void clear_reverse_video();
+  bool reverse_video() const;
+  void set_reverse_video(bool value);
+  private:
+  bool _internal_reverse_video() const;
+  void _internal_set_reverse_video(bool value);
+  public:
+
+  // optional bool bracketed_paste = 10;
+  bool has_bracketed_paste() const;
+  private:
+  bool _internal_has_bracketed_paste() const;
+  public:
+  void clear_bracketed_paste();
+  bool bracketed_paste() const;
+  void set_bracketed_paste(bool value);
+  private:
+  bool _internal_bracketed_paste() const;
+  void _internal_set_bracketed_paste(bool value);
+  public:
+
+  // optional bool mouse_focus_event = 12;
+  bool has_mouse_focus_event() const;
+  private:
+  bool _internal_has_mouse_focus_event() const;
+  public:
+  void clear_mouse_focus_event();
+  bool mouse_focus_event() const;
+  void set_mouse_focus_event(bool value);
+  private:
+  bool _internal_mouse_focus_event() const;
+  void _internal_set_mouse_focus_event(bool value);
+  public:
+
+  // optional uint32 mouse_reporting_mode = 11;
+  bool has_mouse_reporting_mode() const;
+  private:
+  bool _internal_has_mouse_reporting_mode() const;
+  public:
+  void clear_mouse_reporting_mode();
+  uint32_t mouse_reporting_mode() const;
+  void set_mouse_reporting_mode(uint32_t value);
+  private:
+  uint32_t _internal_mouse_reporting_mode() const;
+  void _internal_set_mouse_reporting_mode(uint32_t value);
+  public:
+
+  // optional uint32 mouse_encoding_mode = 14;
+  bool has_mouse_encoding_mode() const;
+  private:
+  bool _internal_has_mouse_encoding_mode() const;
+  public:
+  void clear_mouse_encoding_mode();
+  uint32_t mouse_encoding_mode() const;
+  void set_mouse_encoding_mode(uint32_t value);
+  private:
+  uint32_t _internal_mouse_encoding_mode() const;
+  void _internal_set_mouse_encoding_mode(uint32_t value);
+  public:
+
+  // optional bool mouse_alternate_scroll = 13;
+  bool has_mouse_alternate_scroll() const;
+  private:
+  bool _internal_has_mouse_alternate_scroll() const;
+  public:
+  void clear_mouse_alternate_scroll();
+  bool mouse_alternate_scroll() const;
+  void set_mouse_alternate_scroll(bool value);
+  private:
+  bool _internal_mouse_alternate_scroll() const;
+  void _internal_set_mouse_alternate_scroll(bool value);
+  public:
+
+  // optional bool title_initialized = 15;
+  bool has_title_initialized() const;
+  private:
+  bool _internal_has_title_initialized() const;
+  public:
+  void clear_title_initialized();
+  bool title_initialized() const;
+  void set_title_initialized(bool value);
+  private:
+  bool _internal_title_initialized() const;
+  void _internal_set_title_initialized(bool value);
+  public:
+
+  // optional uint32 bell_count = 19;
+  bool has_bell_count() const;
+  private:
+  bool _internal_has_bell_count() const;
+  public:
+  void clear_bell_count();
+  uint32_t bell_count() const;
+  void set_bell_count(uint32_t value);
+  private:
+  uint32_t _internal_bell_count() const;
+  void _internal_set_bell_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:HostBuffers.FrameUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::RenditionEntry > rendition_table_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::HyperlinkEntry > hyperlink_table_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr rows_;
+    ::HostBuffers::Text* icon_name_;
+    ::HostBuffers::Text* window_title_;
+    ::HostBuffers::Text* clipboard_;
+    uint32_t cursor_row_;
+    uint32_t cursor_col_;
+    uint32_t current_rendition_;
+    uint32_t current_hyperlink_;
+    bool cursor_visible_;
+    bool reverse_video_;
+    bool bracketed_paste_;
+    bool mouse_focus_event_;
+    uint32_t mouse_reporting_mode_;
+    uint32_t mouse_encoding_mode_;
+    bool mouse_alternate_scroll_;
+    bool title_initialized_;
+    uint32_t bell_count_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_hostinput_2eproto;
+};
+// ===================================================================
+
+static const int kHostbytesFieldNumber = 2;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::HostBytes >, 11, false >
+  hostbytes;
+static const int kResizeFieldNumber = 3;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::ResizeMessage >, 11, false >
+  resize;
+static const int kEchoackFieldNumber = 7;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::EchoAck >, 11, false >
+  echoack;
+static const int kFrameupdateFieldNumber = 9;
+extern ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::HostBuffers::Instruction,
+    ::PROTOBUF_NAMESPACE_ID::internal::MessageTypeTraits< ::HostBuffers::FrameUpdate >, 11, false >
+  frameupdate;
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// HostMessage
+
+// repeated .HostBuffers.Instruction instruction = 1;
+inline int HostMessage::_internal_instruction_size() const {
+  return _impl_.instruction_.size();
+}
+inline int HostMessage::instruction_size() const {
+  return _internal_instruction_size();
+}
+inline void HostMessage::clear_instruction() {
+  _impl_.instruction_.Clear();
+}
+inline ::HostBuffers::Instruction* HostMessage::mutable_instruction(int index) {
+  // @@protoc_insertion_point(field_mutable:HostBuffers.HostMessage.instruction)
+  return _impl_.instruction_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::Instruction >*
+HostMessage::mutable_instruction() {
+  // @@protoc_insertion_point(field_mutable_list:HostBuffers.HostMessage.instruction)
+  return &_impl_.instruction_;
+}
+inline const ::HostBuffers::Instruction& HostMessage::_internal_instruction(int index) const {
+  return _impl_.instruction_.Get(index);
+}
+inline const ::HostBuffers::Instruction& HostMessage::instruction(int index) const {
+  // @@protoc_insertion_point(field_get:HostBuffers.HostMessage.instruction)
+  return _internal_instruction(index);
+}
+inline ::HostBuffers::Instruction* HostMessage::_internal_add_instruction() {
+  return _impl_.instruction_.Add();
+}
+inline ::HostBuffers::Instruction* HostMessage::add_instruction() {
+  ::HostBuffers::Instruction* _add = _internal_add_instruction();
+  // @@protoc_insertion_point(field_add:HostBuffers.HostMessage.instruction)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::Instruction >&
+HostMessage::instruction() const {
+  // @@protoc_insertion_point(field_list:HostBuffers.HostMessage.instruction)
+  return _impl_.instruction_;
+}
+
+// -------------------------------------------------------------------
+
+// Instruction
+
+// -------------------------------------------------------------------
+
+// HostBytes
+
+// optional bytes hoststring = 4;
+inline bool HostBytes::_internal_has_hoststring() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HostBytes::has_hoststring() const {
+  return _internal_has_hoststring();
+}
+inline void HostBytes::clear_hoststring() {
+  _impl_.hoststring_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HostBytes::hoststring() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.HostBytes.hoststring)
+  return _internal_hoststring();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HostBytes::set_hoststring(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.hoststring_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HostBuffers.HostBytes.hoststring)
+}
+inline std::string* HostBytes::mutable_hoststring() {
+  std::string* _s = _internal_mutable_hoststring();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.HostBytes.hoststring)
+  return _s;
+}
+inline const std::string& HostBytes::_internal_hoststring() const {
+  return _impl_.hoststring_.Get();
+}
+inline void HostBytes::_internal_set_hoststring(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hoststring_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HostBytes::_internal_mutable_hoststring() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.hoststring_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HostBytes::release_hoststring() {
+  // @@protoc_insertion_point(field_release:HostBuffers.HostBytes.hoststring)
+  if (!_internal_has_hoststring()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.hoststring_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hoststring_.IsDefault()) {
+    _impl_.hoststring_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HostBytes::set_allocated_hoststring(std::string* hoststring) {
+  if (hoststring != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.hoststring_.SetAllocated(hoststring, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hoststring_.IsDefault()) {
+    _impl_.hoststring_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.HostBytes.hoststring)
+}
+
+// -------------------------------------------------------------------
+
+// ResizeMessage
+
+// optional int32 width = 5;
+inline bool ResizeMessage::_internal_has_width() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ResizeMessage::has_width() const {
+  return _internal_has_width();
+}
+inline void ResizeMessage::clear_width() {
+  _impl_.width_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t ResizeMessage::_internal_width() const {
+  return _impl_.width_;
+}
+inline int32_t ResizeMessage::width() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.ResizeMessage.width)
+  return _internal_width();
+}
+inline void ResizeMessage::_internal_set_width(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.width_ = value;
+}
+inline void ResizeMessage::set_width(int32_t value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.ResizeMessage.width)
+}
+
+// optional int32 height = 6;
+inline bool ResizeMessage::_internal_has_height() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ResizeMessage::has_height() const {
+  return _internal_has_height();
+}
+inline void ResizeMessage::clear_height() {
+  _impl_.height_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t ResizeMessage::_internal_height() const {
+  return _impl_.height_;
+}
+inline int32_t ResizeMessage::height() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.ResizeMessage.height)
+  return _internal_height();
+}
+inline void ResizeMessage::_internal_set_height(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.height_ = value;
+}
+inline void ResizeMessage::set_height(int32_t value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.ResizeMessage.height)
+}
+
+// -------------------------------------------------------------------
+
+// EchoAck
+
+// optional uint64 echo_ack_num = 8;
+inline bool EchoAck::_internal_has_echo_ack_num() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EchoAck::has_echo_ack_num() const {
+  return _internal_has_echo_ack_num();
+}
+inline void EchoAck::clear_echo_ack_num() {
+  _impl_.echo_ack_num_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t EchoAck::_internal_echo_ack_num() const {
+  return _impl_.echo_ack_num_;
+}
+inline uint64_t EchoAck::echo_ack_num() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.EchoAck.echo_ack_num)
+  return _internal_echo_ack_num();
+}
+inline void EchoAck::_internal_set_echo_ack_num(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.echo_ack_num_ = value;
+}
+inline void EchoAck::set_echo_ack_num(uint64_t value) {
+  _internal_set_echo_ack_num(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.EchoAck.echo_ack_num)
+}
+
+// -------------------------------------------------------------------
+
+// RenditionEntry
+
+// optional uint32 foreground = 1;
+inline bool RenditionEntry::_internal_has_foreground() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool RenditionEntry::has_foreground() const {
+  return _internal_has_foreground();
+}
+inline void RenditionEntry::clear_foreground() {
+  _impl_.foreground_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t RenditionEntry::_internal_foreground() const {
+  return _impl_.foreground_;
+}
+inline uint32_t RenditionEntry::foreground() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.RenditionEntry.foreground)
+  return _internal_foreground();
+}
+inline void RenditionEntry::_internal_set_foreground(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.foreground_ = value;
+}
+inline void RenditionEntry::set_foreground(uint32_t value) {
+  _internal_set_foreground(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.RenditionEntry.foreground)
+}
+
+// optional uint32 background = 2;
+inline bool RenditionEntry::_internal_has_background() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool RenditionEntry::has_background() const {
+  return _internal_has_background();
+}
+inline void RenditionEntry::clear_background() {
+  _impl_.background_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t RenditionEntry::_internal_background() const {
+  return _impl_.background_;
+}
+inline uint32_t RenditionEntry::background() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.RenditionEntry.background)
+  return _internal_background();
+}
+inline void RenditionEntry::_internal_set_background(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.background_ = value;
+}
+inline void RenditionEntry::set_background(uint32_t value) {
+  _internal_set_background(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.RenditionEntry.background)
+}
+
+// optional uint32 attributes = 3;
+inline bool RenditionEntry::_internal_has_attributes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool RenditionEntry::has_attributes() const {
+  return _internal_has_attributes();
+}
+inline void RenditionEntry::clear_attributes() {
+  _impl_.attributes_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t RenditionEntry::_internal_attributes() const {
+  return _impl_.attributes_;
+}
+inline uint32_t RenditionEntry::attributes() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.RenditionEntry.attributes)
+  return _internal_attributes();
+}
+inline void RenditionEntry::_internal_set_attributes(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.attributes_ = value;
+}
+inline void RenditionEntry::set_attributes(uint32_t value) {
+  _internal_set_attributes(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.RenditionEntry.attributes)
+}
+
+// -------------------------------------------------------------------
+
+// HyperlinkEntry
+
+// optional bytes params = 1;
+inline bool HyperlinkEntry::_internal_has_params() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HyperlinkEntry::has_params() const {
+  return _internal_has_params();
+}
+inline void HyperlinkEntry::clear_params() {
+  _impl_.params_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HyperlinkEntry::params() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.HyperlinkEntry.params)
+  return _internal_params();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HyperlinkEntry::set_params(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.params_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HostBuffers.HyperlinkEntry.params)
+}
+inline std::string* HyperlinkEntry::mutable_params() {
+  std::string* _s = _internal_mutable_params();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.HyperlinkEntry.params)
+  return _s;
+}
+inline const std::string& HyperlinkEntry::_internal_params() const {
+  return _impl_.params_.Get();
+}
+inline void HyperlinkEntry::_internal_set_params(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.params_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HyperlinkEntry::_internal_mutable_params() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.params_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HyperlinkEntry::release_params() {
+  // @@protoc_insertion_point(field_release:HostBuffers.HyperlinkEntry.params)
+  if (!_internal_has_params()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.params_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.params_.IsDefault()) {
+    _impl_.params_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HyperlinkEntry::set_allocated_params(std::string* params) {
+  if (params != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.params_.SetAllocated(params, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.params_.IsDefault()) {
+    _impl_.params_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.HyperlinkEntry.params)
+}
+
+// optional bytes url = 2;
+inline bool HyperlinkEntry::_internal_has_url() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HyperlinkEntry::has_url() const {
+  return _internal_has_url();
+}
+inline void HyperlinkEntry::clear_url() {
+  _impl_.url_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& HyperlinkEntry::url() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.HyperlinkEntry.url)
+  return _internal_url();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HyperlinkEntry::set_url(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.url_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HostBuffers.HyperlinkEntry.url)
+}
+inline std::string* HyperlinkEntry::mutable_url() {
+  std::string* _s = _internal_mutable_url();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.HyperlinkEntry.url)
+  return _s;
+}
+inline const std::string& HyperlinkEntry::_internal_url() const {
+  return _impl_.url_.Get();
+}
+inline void HyperlinkEntry::_internal_set_url(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.url_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HyperlinkEntry::_internal_mutable_url() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.url_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HyperlinkEntry::release_url() {
+  // @@protoc_insertion_point(field_release:HostBuffers.HyperlinkEntry.url)
+  if (!_internal_has_url()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.url_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.url_.IsDefault()) {
+    _impl_.url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HyperlinkEntry::set_allocated_url(std::string* url) {
+  if (url != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.url_.SetAllocated(url, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.url_.IsDefault()) {
+    _impl_.url_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.HyperlinkEntry.url)
+}
+
+// -------------------------------------------------------------------
+
+// Text
+
+// repeated uint32 codepoint = 1 [packed = true];
+inline int Text::_internal_codepoint_size() const {
+  return _impl_.codepoint_.size();
+}
+inline int Text::codepoint_size() const {
+  return _internal_codepoint_size();
+}
+inline void Text::clear_codepoint() {
+  _impl_.codepoint_.Clear();
+}
+inline uint32_t Text::_internal_codepoint(int index) const {
+  return _impl_.codepoint_.Get(index);
+}
+inline uint32_t Text::codepoint(int index) const {
+  // @@protoc_insertion_point(field_get:HostBuffers.Text.codepoint)
+  return _internal_codepoint(index);
+}
+inline void Text::set_codepoint(int index, uint32_t value) {
+  _impl_.codepoint_.Set(index, value);
+  // @@protoc_insertion_point(field_set:HostBuffers.Text.codepoint)
+}
+inline void Text::_internal_add_codepoint(uint32_t value) {
+  _impl_.codepoint_.Add(value);
+}
+inline void Text::add_codepoint(uint32_t value) {
+  _internal_add_codepoint(value);
+  // @@protoc_insertion_point(field_add:HostBuffers.Text.codepoint)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Text::_internal_codepoint() const {
+  return _impl_.codepoint_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Text::codepoint() const {
+  // @@protoc_insertion_point(field_list:HostBuffers.Text.codepoint)
+  return _internal_codepoint();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Text::_internal_mutable_codepoint() {
+  return &_impl_.codepoint_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Text::mutable_codepoint() {
+  // @@protoc_insertion_point(field_mutable_list:HostBuffers.Text.codepoint)
+  return _internal_mutable_codepoint();
+}
+
+// -------------------------------------------------------------------
+
+// FrameUpdate
+
+// repeated .HostBuffers.RenditionEntry rendition_table = 1;
+inline int FrameUpdate::_internal_rendition_table_size() const {
+  return _impl_.rendition_table_.size();
+}
+inline int FrameUpdate::rendition_table_size() const {
+  return _internal_rendition_table_size();
+}
+inline void FrameUpdate::clear_rendition_table() {
+  _impl_.rendition_table_.Clear();
+}
+inline ::HostBuffers::RenditionEntry* FrameUpdate::mutable_rendition_table(int index) {
+  // @@protoc_insertion_point(field_mutable:HostBuffers.FrameUpdate.rendition_table)
+  return _impl_.rendition_table_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::RenditionEntry >*
+FrameUpdate::mutable_rendition_table() {
+  // @@protoc_insertion_point(field_mutable_list:HostBuffers.FrameUpdate.rendition_table)
+  return &_impl_.rendition_table_;
+}
+inline const ::HostBuffers::RenditionEntry& FrameUpdate::_internal_rendition_table(int index) const {
+  return _impl_.rendition_table_.Get(index);
+}
+inline const ::HostBuffers::RenditionEntry& FrameUpdate::rendition_table(int index) const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.rendition_table)
+  return _internal_rendition_table(index);
+}
+inline ::HostBuffers::RenditionEntry* FrameUpdate::_internal_add_rendition_table() {
+  return _impl_.rendition_table_.Add();
+}
+inline ::HostBuffers::RenditionEntry* FrameUpdate::add_rendition_table() {
+  ::HostBuffers::RenditionEntry* _add = _internal_add_rendition_table();
+  // @@protoc_insertion_point(field_add:HostBuffers.FrameUpdate.rendition_table)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::RenditionEntry >&
+FrameUpdate::rendition_table() const {
+  // @@protoc_insertion_point(field_list:HostBuffers.FrameUpdate.rendition_table)
+  return _impl_.rendition_table_;
+}
+
+// repeated .HostBuffers.HyperlinkEntry hyperlink_table = 2;
+inline int FrameUpdate::_internal_hyperlink_table_size() const {
+  return _impl_.hyperlink_table_.size();
+}
+inline int FrameUpdate::hyperlink_table_size() const {
+  return _internal_hyperlink_table_size();
+}
+inline void FrameUpdate::clear_hyperlink_table() {
+  _impl_.hyperlink_table_.Clear();
+}
+inline ::HostBuffers::HyperlinkEntry* FrameUpdate::mutable_hyperlink_table(int index) {
+  // @@protoc_insertion_point(field_mutable:HostBuffers.FrameUpdate.hyperlink_table)
+  return _impl_.hyperlink_table_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::HyperlinkEntry >*
+FrameUpdate::mutable_hyperlink_table() {
+  // @@protoc_insertion_point(field_mutable_list:HostBuffers.FrameUpdate.hyperlink_table)
+  return &_impl_.hyperlink_table_;
+}
+inline const ::HostBuffers::HyperlinkEntry& FrameUpdate::_internal_hyperlink_table(int index) const {
+  return _impl_.hyperlink_table_.Get(index);
+}
+inline const ::HostBuffers::HyperlinkEntry& FrameUpdate::hyperlink_table(int index) const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.hyperlink_table)
+  return _internal_hyperlink_table(index);
+}
+inline ::HostBuffers::HyperlinkEntry* FrameUpdate::_internal_add_hyperlink_table() {
+  return _impl_.hyperlink_table_.Add();
+}
+inline ::HostBuffers::HyperlinkEntry* FrameUpdate::add_hyperlink_table() {
+  ::HostBuffers::HyperlinkEntry* _add = _internal_add_hyperlink_table();
+  // @@protoc_insertion_point(field_add:HostBuffers.FrameUpdate.hyperlink_table)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::HostBuffers::HyperlinkEntry >&
+FrameUpdate::hyperlink_table() const {
+  // @@protoc_insertion_point(field_list:HostBuffers.FrameUpdate.hyperlink_table)
+  return _impl_.hyperlink_table_;
+}
+
+// optional bytes rows = 3;
+inline bool FrameUpdate::_internal_has_rows() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_rows() const {
+  return _internal_has_rows();
+}
+inline void FrameUpdate::clear_rows() {
+  _impl_.rows_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& FrameUpdate::rows() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.rows)
+  return _internal_rows();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FrameUpdate::set_rows(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.rows_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.rows)
+}
+inline std::string* FrameUpdate::mutable_rows() {
+  std::string* _s = _internal_mutable_rows();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.FrameUpdate.rows)
+  return _s;
+}
+inline const std::string& FrameUpdate::_internal_rows() const {
+  return _impl_.rows_.Get();
+}
+inline void FrameUpdate::_internal_set_rows(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.rows_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FrameUpdate::_internal_mutable_rows() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.rows_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FrameUpdate::release_rows() {
+  // @@protoc_insertion_point(field_release:HostBuffers.FrameUpdate.rows)
+  if (!_internal_has_rows()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.rows_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rows_.IsDefault()) {
+    _impl_.rows_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void FrameUpdate::set_allocated_rows(std::string* rows) {
+  if (rows != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.rows_.SetAllocated(rows, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.rows_.IsDefault()) {
+    _impl_.rows_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.FrameUpdate.rows)
+}
+
+// optional uint32 cursor_row = 4;
+inline bool FrameUpdate::_internal_has_cursor_row() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_cursor_row() const {
+  return _internal_has_cursor_row();
+}
+inline void FrameUpdate::clear_cursor_row() {
+  _impl_.cursor_row_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t FrameUpdate::_internal_cursor_row() const {
+  return _impl_.cursor_row_;
+}
+inline uint32_t FrameUpdate::cursor_row() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.cursor_row)
+  return _internal_cursor_row();
+}
+inline void FrameUpdate::_internal_set_cursor_row(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.cursor_row_ = value;
+}
+inline void FrameUpdate::set_cursor_row(uint32_t value) {
+  _internal_set_cursor_row(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.cursor_row)
+}
+
+// optional uint32 cursor_col = 5;
+inline bool FrameUpdate::_internal_has_cursor_col() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_cursor_col() const {
+  return _internal_has_cursor_col();
+}
+inline void FrameUpdate::clear_cursor_col() {
+  _impl_.cursor_col_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint32_t FrameUpdate::_internal_cursor_col() const {
+  return _impl_.cursor_col_;
+}
+inline uint32_t FrameUpdate::cursor_col() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.cursor_col)
+  return _internal_cursor_col();
+}
+inline void FrameUpdate::_internal_set_cursor_col(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.cursor_col_ = value;
+}
+inline void FrameUpdate::set_cursor_col(uint32_t value) {
+  _internal_set_cursor_col(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.cursor_col)
+}
+
+// optional bool cursor_visible = 6;
+inline bool FrameUpdate::_internal_has_cursor_visible() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_cursor_visible() const {
+  return _internal_has_cursor_visible();
+}
+inline void FrameUpdate::clear_cursor_visible() {
+  _impl_.cursor_visible_ = false;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline bool FrameUpdate::_internal_cursor_visible() const {
+  return _impl_.cursor_visible_;
+}
+inline bool FrameUpdate::cursor_visible() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.cursor_visible)
+  return _internal_cursor_visible();
+}
+inline void FrameUpdate::_internal_set_cursor_visible(bool value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.cursor_visible_ = value;
+}
+inline void FrameUpdate::set_cursor_visible(bool value) {
+  _internal_set_cursor_visible(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.cursor_visible)
+}
+
+// optional uint32 current_rendition = 7;
+inline bool FrameUpdate::_internal_has_current_rendition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_current_rendition() const {
+  return _internal_has_current_rendition();
+}
+inline void FrameUpdate::clear_current_rendition() {
+  _impl_.current_rendition_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline uint32_t FrameUpdate::_internal_current_rendition() const {
+  return _impl_.current_rendition_;
+}
+inline uint32_t FrameUpdate::current_rendition() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.current_rendition)
+  return _internal_current_rendition();
+}
+inline void FrameUpdate::_internal_set_current_rendition(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.current_rendition_ = value;
+}
+inline void FrameUpdate::set_current_rendition(uint32_t value) {
+  _internal_set_current_rendition(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.current_rendition)
+}
+
+// optional uint32 current_hyperlink = 8;
+inline bool FrameUpdate::_internal_has_current_hyperlink() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_current_hyperlink() const {
+  return _internal_has_current_hyperlink();
+}
+inline void FrameUpdate::clear_current_hyperlink() {
+  _impl_.current_hyperlink_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline uint32_t FrameUpdate::_internal_current_hyperlink() const {
+  return _impl_.current_hyperlink_;
+}
+inline uint32_t FrameUpdate::current_hyperlink() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.current_hyperlink)
+  return _internal_current_hyperlink();
+}
+inline void FrameUpdate::_internal_set_current_hyperlink(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.current_hyperlink_ = value;
+}
+inline void FrameUpdate::set_current_hyperlink(uint32_t value) {
+  _internal_set_current_hyperlink(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.current_hyperlink)
+}
+
+// optional bool reverse_video = 9;
+inline bool FrameUpdate::_internal_has_reverse_video() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_reverse_video() const {
+  return _internal_has_reverse_video();
+}
+inline void FrameUpdate::clear_reverse_video() {
+  _impl_.reverse_video_ = false;
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline bool FrameUpdate::_internal_reverse_video() const {
+  return _impl_.reverse_video_;
+}
+inline bool FrameUpdate::reverse_video() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.reverse_video)
+  return _internal_reverse_video();
+}
+inline void FrameUpdate::_internal_set_reverse_video(bool value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.reverse_video_ = value;
+}
+inline void FrameUpdate::set_reverse_video(bool value) {
+  _internal_set_reverse_video(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.reverse_video)
+}
+
+// optional bool bracketed_paste = 10;
+inline bool FrameUpdate::_internal_has_bracketed_paste() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_bracketed_paste() const {
+  return _internal_has_bracketed_paste();
+}
+inline void FrameUpdate::clear_bracketed_paste() {
+  _impl_.bracketed_paste_ = false;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline bool FrameUpdate::_internal_bracketed_paste() const {
+  return _impl_.bracketed_paste_;
+}
+inline bool FrameUpdate::bracketed_paste() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.bracketed_paste)
+  return _internal_bracketed_paste();
+}
+inline void FrameUpdate::_internal_set_bracketed_paste(bool value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.bracketed_paste_ = value;
+}
+inline void FrameUpdate::set_bracketed_paste(bool value) {
+  _internal_set_bracketed_paste(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.bracketed_paste)
+}
+
+// optional uint32 mouse_reporting_mode = 11;
+inline bool FrameUpdate::_internal_has_mouse_reporting_mode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00001000u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_mouse_reporting_mode() const {
+  return _internal_has_mouse_reporting_mode();
+}
+inline void FrameUpdate::clear_mouse_reporting_mode() {
+  _impl_.mouse_reporting_mode_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00001000u;
+}
+inline uint32_t FrameUpdate::_internal_mouse_reporting_mode() const {
+  return _impl_.mouse_reporting_mode_;
+}
+inline uint32_t FrameUpdate::mouse_reporting_mode() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.mouse_reporting_mode)
+  return _internal_mouse_reporting_mode();
+}
+inline void FrameUpdate::_internal_set_mouse_reporting_mode(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00001000u;
+  _impl_.mouse_reporting_mode_ = value;
+}
+inline void FrameUpdate::set_mouse_reporting_mode(uint32_t value) {
+  _internal_set_mouse_reporting_mode(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.mouse_reporting_mode)
+}
+
+// optional bool mouse_focus_event = 12;
+inline bool FrameUpdate::_internal_has_mouse_focus_event() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_mouse_focus_event() const {
+  return _internal_has_mouse_focus_event();
+}
+inline void FrameUpdate::clear_mouse_focus_event() {
+  _impl_.mouse_focus_event_ = false;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline bool FrameUpdate::_internal_mouse_focus_event() const {
+  return _impl_.mouse_focus_event_;
+}
+inline bool FrameUpdate::mouse_focus_event() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.mouse_focus_event)
+  return _internal_mouse_focus_event();
+}
+inline void FrameUpdate::_internal_set_mouse_focus_event(bool value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.mouse_focus_event_ = value;
+}
+inline void FrameUpdate::set_mouse_focus_event(bool value) {
+  _internal_set_mouse_focus_event(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.mouse_focus_event)
+}
+
+// optional bool mouse_alternate_scroll = 13;
+inline bool FrameUpdate::_internal_has_mouse_alternate_scroll() const {
+  bool value = (_impl_._has_bits_[0] & 0x00004000u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_mouse_alternate_scroll() const {
+  return _internal_has_mouse_alternate_scroll();
+}
+inline void FrameUpdate::clear_mouse_alternate_scroll() {
+  _impl_.mouse_alternate_scroll_ = false;
+  _impl_._has_bits_[0] &= ~0x00004000u;
+}
+inline bool FrameUpdate::_internal_mouse_alternate_scroll() const {
+  return _impl_.mouse_alternate_scroll_;
+}
+inline bool FrameUpdate::mouse_alternate_scroll() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.mouse_alternate_scroll)
+  return _internal_mouse_alternate_scroll();
+}
+inline void FrameUpdate::_internal_set_mouse_alternate_scroll(bool value) {
+  _impl_._has_bits_[0] |= 0x00004000u;
+  _impl_.mouse_alternate_scroll_ = value;
+}
+inline void FrameUpdate::set_mouse_alternate_scroll(bool value) {
+  _internal_set_mouse_alternate_scroll(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.mouse_alternate_scroll)
+}
+
+// optional uint32 mouse_encoding_mode = 14;
+inline bool FrameUpdate::_internal_has_mouse_encoding_mode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00002000u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_mouse_encoding_mode() const {
+  return _internal_has_mouse_encoding_mode();
+}
+inline void FrameUpdate::clear_mouse_encoding_mode() {
+  _impl_.mouse_encoding_mode_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00002000u;
+}
+inline uint32_t FrameUpdate::_internal_mouse_encoding_mode() const {
+  return _impl_.mouse_encoding_mode_;
+}
+inline uint32_t FrameUpdate::mouse_encoding_mode() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.mouse_encoding_mode)
+  return _internal_mouse_encoding_mode();
+}
+inline void FrameUpdate::_internal_set_mouse_encoding_mode(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00002000u;
+  _impl_.mouse_encoding_mode_ = value;
+}
+inline void FrameUpdate::set_mouse_encoding_mode(uint32_t value) {
+  _internal_set_mouse_encoding_mode(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.mouse_encoding_mode)
+}
+
+// optional bool title_initialized = 15;
+inline bool FrameUpdate::_internal_has_title_initialized() const {
+  bool value = (_impl_._has_bits_[0] & 0x00008000u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_title_initialized() const {
+  return _internal_has_title_initialized();
+}
+inline void FrameUpdate::clear_title_initialized() {
+  _impl_.title_initialized_ = false;
+  _impl_._has_bits_[0] &= ~0x00008000u;
+}
+inline bool FrameUpdate::_internal_title_initialized() const {
+  return _impl_.title_initialized_;
+}
+inline bool FrameUpdate::title_initialized() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.title_initialized)
+  return _internal_title_initialized();
+}
+inline void FrameUpdate::_internal_set_title_initialized(bool value) {
+  _impl_._has_bits_[0] |= 0x00008000u;
+  _impl_.title_initialized_ = value;
+}
+inline void FrameUpdate::set_title_initialized(bool value) {
+  _internal_set_title_initialized(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.title_initialized)
+}
+
+// optional .HostBuffers.Text icon_name = 16;
+inline bool FrameUpdate::_internal_has_icon_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.icon_name_ != nullptr);
+  return value;
+}
+inline bool FrameUpdate::has_icon_name() const {
+  return _internal_has_icon_name();
+}
+inline void FrameUpdate::clear_icon_name() {
+  if (_impl_.icon_name_ != nullptr) _impl_.icon_name_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::HostBuffers::Text& FrameUpdate::_internal_icon_name() const {
+  const ::HostBuffers::Text* p = _impl_.icon_name_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HostBuffers::Text&>(
+      ::HostBuffers::_Text_default_instance_);
+}
+inline const ::HostBuffers::Text& FrameUpdate::icon_name() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.icon_name)
+  return _internal_icon_name();
+}
+inline void FrameUpdate::unsafe_arena_set_allocated_icon_name(
+    ::HostBuffers::Text* icon_name) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.icon_name_);
+  }
+  _impl_.icon_name_ = icon_name;
+  if (icon_name) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HostBuffers.FrameUpdate.icon_name)
+}
+inline ::HostBuffers::Text* FrameUpdate::release_icon_name() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::HostBuffers::Text* temp = _impl_.icon_name_;
+  _impl_.icon_name_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HostBuffers::Text* FrameUpdate::unsafe_arena_release_icon_name() {
+  // @@protoc_insertion_point(field_release:HostBuffers.FrameUpdate.icon_name)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::HostBuffers::Text* temp = _impl_.icon_name_;
+  _impl_.icon_name_ = nullptr;
+  return temp;
+}
+inline ::HostBuffers::Text* FrameUpdate::_internal_mutable_icon_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.icon_name_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HostBuffers::Text>(GetArenaForAllocation());
+    _impl_.icon_name_ = p;
+  }
+  return _impl_.icon_name_;
+}
+inline ::HostBuffers::Text* FrameUpdate::mutable_icon_name() {
+  ::HostBuffers::Text* _msg = _internal_mutable_icon_name();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.FrameUpdate.icon_name)
+  return _msg;
+}
+inline void FrameUpdate::set_allocated_icon_name(::HostBuffers::Text* icon_name) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.icon_name_;
+  }
+  if (icon_name) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(icon_name);
+    if (message_arena != submessage_arena) {
+      icon_name = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, icon_name, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.icon_name_ = icon_name;
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.FrameUpdate.icon_name)
+}
+
+// optional .HostBuffers.Text window_title = 17;
+inline bool FrameUpdate::_internal_has_window_title() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.window_title_ != nullptr);
+  return value;
+}
+inline bool FrameUpdate::has_window_title() const {
+  return _internal_has_window_title();
+}
+inline void FrameUpdate::clear_window_title() {
+  if (_impl_.window_title_ != nullptr) _impl_.window_title_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::HostBuffers::Text& FrameUpdate::_internal_window_title() const {
+  const ::HostBuffers::Text* p = _impl_.window_title_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HostBuffers::Text&>(
+      ::HostBuffers::_Text_default_instance_);
+}
+inline const ::HostBuffers::Text& FrameUpdate::window_title() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.window_title)
+  return _internal_window_title();
+}
+inline void FrameUpdate::unsafe_arena_set_allocated_window_title(
+    ::HostBuffers::Text* window_title) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.window_title_);
+  }
+  _impl_.window_title_ = window_title;
+  if (window_title) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HostBuffers.FrameUpdate.window_title)
+}
+inline ::HostBuffers::Text* FrameUpdate::release_window_title() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HostBuffers::Text* temp = _impl_.window_title_;
+  _impl_.window_title_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HostBuffers::Text* FrameUpdate::unsafe_arena_release_window_title() {
+  // @@protoc_insertion_point(field_release:HostBuffers.FrameUpdate.window_title)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::HostBuffers::Text* temp = _impl_.window_title_;
+  _impl_.window_title_ = nullptr;
+  return temp;
+}
+inline ::HostBuffers::Text* FrameUpdate::_internal_mutable_window_title() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.window_title_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HostBuffers::Text>(GetArenaForAllocation());
+    _impl_.window_title_ = p;
+  }
+  return _impl_.window_title_;
+}
+inline ::HostBuffers::Text* FrameUpdate::mutable_window_title() {
+  ::HostBuffers::Text* _msg = _internal_mutable_window_title();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.FrameUpdate.window_title)
+  return _msg;
+}
+inline void FrameUpdate::set_allocated_window_title(::HostBuffers::Text* window_title) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.window_title_;
+  }
+  if (window_title) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(window_title);
+    if (message_arena != submessage_arena) {
+      window_title = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, window_title, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.window_title_ = window_title;
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.FrameUpdate.window_title)
+}
+
+// optional .HostBuffers.Text clipboard = 18;
+inline bool FrameUpdate::_internal_has_clipboard() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.clipboard_ != nullptr);
+  return value;
+}
+inline bool FrameUpdate::has_clipboard() const {
+  return _internal_has_clipboard();
+}
+inline void FrameUpdate::clear_clipboard() {
+  if (_impl_.clipboard_ != nullptr) _impl_.clipboard_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::HostBuffers::Text& FrameUpdate::_internal_clipboard() const {
+  const ::HostBuffers::Text* p = _impl_.clipboard_;
+  return p != nullptr ? *p : reinterpret_cast<const ::HostBuffers::Text&>(
+      ::HostBuffers::_Text_default_instance_);
+}
+inline const ::HostBuffers::Text& FrameUpdate::clipboard() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.clipboard)
+  return _internal_clipboard();
+}
+inline void FrameUpdate::unsafe_arena_set_allocated_clipboard(
+    ::HostBuffers::Text* clipboard) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.clipboard_);
+  }
+  _impl_.clipboard_ = clipboard;
+  if (clipboard) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:HostBuffers.FrameUpdate.clipboard)
+}
+inline ::HostBuffers::Text* FrameUpdate::release_clipboard() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::HostBuffers::Text* temp = _impl_.clipboard_;
+  _impl_.clipboard_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::HostBuffers::Text* FrameUpdate::unsafe_arena_release_clipboard() {
+  // @@protoc_insertion_point(field_release:HostBuffers.FrameUpdate.clipboard)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::HostBuffers::Text* temp = _impl_.clipboard_;
+  _impl_.clipboard_ = nullptr;
+  return temp;
+}
+inline ::HostBuffers::Text* FrameUpdate::_internal_mutable_clipboard() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.clipboard_ == nullptr) {
+    auto* p = CreateMaybeMessage<::HostBuffers::Text>(GetArenaForAllocation());
+    _impl_.clipboard_ = p;
+  }
+  return _impl_.clipboard_;
+}
+inline ::HostBuffers::Text* FrameUpdate::mutable_clipboard() {
+  ::HostBuffers::Text* _msg = _internal_mutable_clipboard();
+  // @@protoc_insertion_point(field_mutable:HostBuffers.FrameUpdate.clipboard)
+  return _msg;
+}
+inline void FrameUpdate::set_allocated_clipboard(::HostBuffers::Text* clipboard) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.clipboard_;
+  }
+  if (clipboard) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(clipboard);
+    if (message_arena != submessage_arena) {
+      clipboard = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, clipboard, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.clipboard_ = clipboard;
+  // @@protoc_insertion_point(field_set_allocated:HostBuffers.FrameUpdate.clipboard)
+}
+
+// optional uint32 bell_count = 19;
+inline bool FrameUpdate::_internal_has_bell_count() const {
+  bool value = (_impl_._has_bits_[0] & 0x00010000u) != 0;
+  return value;
+}
+inline bool FrameUpdate::has_bell_count() const {
+  return _internal_has_bell_count();
+}
+inline void FrameUpdate::clear_bell_count() {
+  _impl_.bell_count_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00010000u;
+}
+inline uint32_t FrameUpdate::_internal_bell_count() const {
+  return _impl_.bell_count_;
+}
+inline uint32_t FrameUpdate::bell_count() const {
+  // @@protoc_insertion_point(field_get:HostBuffers.FrameUpdate.bell_count)
+  return _internal_bell_count();
+}
+inline void FrameUpdate::_internal_set_bell_count(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00010000u;
+  _impl_.bell_count_ = value;
+}
+inline void FrameUpdate::set_bell_count(uint32_t value) {
+  _internal_set_bell_count(value);
+  // @@protoc_insertion_point(field_set:HostBuffers.FrameUpdate.bell_count)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace HostBuffers
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_hostinput_2eproto
@@ -30,10 +30,13 @@
     also delete it here.
 */
 
+#include <algorithm>
 #include <climits>
+#include <cstdint>
 
 #include "src/protobufs/hostinput.pb.h"
 #include "src/statesync/completeterminal.h"
+#include "src/statesync/framediff.h"
 #include "src/util/fatal_assert.h"
 
 using namespace std;
@@ -41,8 +44,15 @@ using namespace Parser;
 using namespace Terminal;
 using namespace HostBuffers;
 
+uint64_t Complete::next_gen( void )
+{
+  static uint64_t gen_counter = 0;
+  return ++gen_counter;
+}
+
 string Complete::act( const string& str )
 {
+  gen = next_gen();
   for ( unsigned int i = 0; i < str.size(); i++ ) {
     /* parse octet into up to three actions */
     parser.input( str[i], actions );
@@ -58,13 +68,45 @@ string Complete::act( const string& str )
   return terminal.read_octets_to_host();
 }
 
+void Complete::act_hostbytes( const string& str )
+{
+  size_t i = 0;
+  while ( i < str.size() ) {
+    if ( parser.is_ground() ) {
+      i += terminal.interpret_hostbytes( str.data() + i, str.size() - i );
+    }
+
+    /* the general parser takes over until it is back between sequences */
+    while ( i < str.size() ) {
+      parser.input( str[i++], actions );
+      for ( Actions::iterator it = actions.begin(); it != actions.end(); it++ ) {
+        Action& act = **it;
+        act.act_on_terminal( &terminal );
+      }
+      actions.clear();
+
+      if ( parser.is_ground() ) {
+        break;
+      }
+    }
+  }
+}
+
 string Complete::act( const Action& act )
 {
+  gen = next_gen();
   /* apply action to terminal */
   act.act_on_terminal( &terminal );
   return terminal.read_octets_to_host();
 }
 
+string Complete::act_userbytes( const string& bytes )
+{
+  gen = next_gen();
+  terminal.user_input( bytes.data(), bytes.size() );
+  return terminal.read_octets_to_host();
+}
+
 /* interface for Network::Transport */
 string Complete::diff_from( const Complete& existing ) const
 {
@@ -76,40 +118,237 @@ string Complete::diff_from( const Complete& existing ) const
     new_echo->MutableExtension( echoack )->set_echo_ack_num( get_echo_ack() );
   }
 
-  if ( !( existing.get_fb() == get_fb() ) ) {
-    if ( ( existing.get_fb().ds.get_width() != terminal.get_fb().ds.get_width() )
-         || ( existing.get_fb().ds.get_height() != terminal.get_fb().ds.get_height() ) ) {
+  if ( ( existing.gen != gen ) && !( existing.get_fb() == get_fb() ) ) {
+    const bool resized = ( existing.get_fb().ds.get_width() != terminal.get_fb().ds.get_width() )
+                         || ( existing.get_fb().ds.get_height() != terminal.get_fb().ds.get_height() );
+    if ( resized ) {
       Instruction* new_res = output.add_instruction();
       new_res->MutableExtension( resize )->set_width( terminal.get_fb().ds.get_width() );
       new_res->MutableExtension( resize )->set_height( terminal.get_fb().ds.get_height() );
     }
-    string update = display.new_frame( true, existing.get_fb(), terminal.get_fb() );
-    if ( !update.empty() ) {
-      Instruction* new_inst = output.add_instruction();
-      new_inst->MutableExtension( hostbytes )->set_hoststring( update );
+    if ( cell_diff ) {
+      FrameUpdate update;
+      if ( resized ) {
+        /* the client resizes its framebuffer before applying the update */
+        Framebuffer last( existing.get_fb() );
+        last.resize( terminal.get_fb().ds.get_width(), terminal.get_fb().ds.get_height() );
+        encode_frame_update( last, terminal.get_fb(), update );
+      } else {
+        encode_frame_update( existing.get_fb(), terminal.get_fb(), update );
+      }
+      if ( update.ByteSizeLong() ) {
+        output.add_instruction()->MutableExtension( frameupdate )->Swap( &update );
+      }
+    } else {
+      string update = display.new_frame( true, existing.get_fb(), terminal.get_fb() );
+      if ( !update.empty() ) {
+        Instruction* new_inst = output.add_instruction();
+        new_inst->MutableExtension( hostbytes )->set_hoststring( update );
+      }
     }
   }
 
   return output.SerializeAsString();
 }
 
+/* Estimated bytes to repaint the cells of one row that differ from
+   another, given the cost of starting each run of changed cells.  A
+   change of rendition within a run costs as much as a new run. */
+static size_t row_damage( const Row& row, const Row& old, size_t run_overhead )
+{
+  size_t damage = 0;
+  bool in_run = false;
+  for ( size_t x = 0; x < row.cells.size(); x++ ) {
+    if ( row.cells[x] == old.cells[x] ) {
+      in_run = false;
+      continue;
+    }
+    damage += row.cells[x].get_contents().size();
+    if ( !in_run || !( row.cells[x].get_renditions() == row.cells[x - 1].get_renditions() ) ) {
+      damage += run_overhead;
+      in_run = true;
+    }
+  }
+  return damage;
+}
+
+/* Estimated size of a HostBuffers::FrameUpdate from old to fb, which
+   must be the same size.  Every changed row costs a row header, except
+   that intact rows moved together share one.  Rows that moved keep
+   their gen and cost only their own damage. */
+static size_t cell_diff_damage( const Framebuffer& fb, const Framebuffer& old, size_t run_overhead )
+{
+  static const size_t ROW_OVERHEAD = 3;
+  const Framebuffer::rows_type& rows = fb.get_rows();
+  const Framebuffer::rows_type& old_rows = old.get_rows();
+  const Row blank( fb.ds.get_width(), 0 );
+  size_t damage = 0;
+
+  using row_index = std::pair<uint64_t, size_t>;
+  std::vector<row_index> old_gens;
+  old_gens.reserve( old_rows.size() );
+  for ( size_t y = 0; y < old_rows.size(); y++ ) {
+    old_gens.push_back( row_index( old_rows[y]->gen, y ) );
+  }
+  std::sort( old_gens.begin(), old_gens.end() );
+
+  size_t run_next = SIZE_MAX; /* source that would continue a run of intact moved rows */
+  for ( size_t y = 0; y < rows.size(); y++ ) {
+    const size_t run_continues = run_next;
+    run_next = SIZE_MAX;
+    if ( rows[y] == old_rows[y] ) {
+      continue;
+    }
+    if ( rows[y]->gen == old_rows[y]->gen ) {
+      const size_t row = row_damage( *rows[y], *old_rows[y], run_overhead );
+      damage += row ? ROW_OVERHEAD + row : 0;
+      continue;
+    }
+    std::vector<row_index>::const_iterator moved
+      = std::lower_bound( old_gens.begin(), old_gens.end(), row_index( rows[y]->gen, 0 ) );
+    if ( ( moved != old_gens.end() ) && ( moved->first == rows[y]->gen ) ) {
+      const size_t row = row_damage( *rows[y], *old_rows[moved->second], run_overhead );
+      if ( row == 0 ) {
+        run_next = moved->second + 1;
+        if ( moved->second == run_continues ) {
+          continue;
+        }
+      }
+      damage += ROW_OVERHEAD + row;
+    } else { /* fresh row, sent as changes to the old one or to a blank row */
+      const size_t row = row_damage( *rows[y], *old_rows[y], run_overhead );
+      if ( row ) {
+        damage += ROW_OVERHEAD + std::min( row, row_damage( *rows[y], blank, run_overhead ) );
+      }
+    }
+  }
+  return damage;
+}
+
+/* Predict the size of diff_from( existing ) from row identity and
+   damage, without rendering it.  Only good for comparing candidates. */
+size_t Complete::estimate_diff_size( const Complete& existing ) const
+{
+  static const size_t INSTRUCTION_OVERHEAD = 8;
+  /* a span header, or cursor motion and renditions */
+  const size_t run_overhead = cell_diff ? 3 : 8;
+
+  if ( existing.gen == gen ) {
+    return 0;
+  }
+
+  size_t estimate = 0;
+  if ( existing.echo_ack != echo_ack ) {
+    estimate += INSTRUCTION_OVERHEAD;
+  }
+
+  const Framebuffer& fb = terminal.get_fb();
+  const Framebuffer& old = existing.get_fb();
+  if ( fb == old ) {
+    return estimate;
+  }
+  estimate += INSTRUCTION_OVERHEAD;
+
+  const Framebuffer::rows_type& rows = fb.get_rows();
+  const Framebuffer::rows_type& old_rows = old.get_rows();
+  const Row blank( fb.ds.get_width(), 0 );
+  if ( ( fb.ds.get_width() != old.ds.get_width() ) || ( fb.ds.get_height() != old.ds.get_height() ) ) {
+    estimate += INSTRUCTION_OVERHEAD; /* the resize */
+    if ( cell_diff ) {
+      /* the client resizes its framebuffer before applying the update */
+      Framebuffer resized( old );
+      resized.resize( fb.ds.get_width(), fb.ds.get_height() );
+      return estimate + cell_diff_damage( fb, resized, run_overhead );
+    }
+    /* full repaint, which first resets every mode */
+    static const size_t MODE_RESETS = 100;
+    for ( Framebuffer::rows_type::const_iterator i = rows.begin(); i != rows.end(); i++ ) {
+      estimate += row_damage( **i, blank, run_overhead );
+    }
+    return estimate + MODE_RESETS;
+  }
+
+  if ( cell_diff ) {
+    estimate += cell_diff_damage( fb, old, run_overhead );
+  } else {
+    /* Display::new_frame() scrolls when the top row reappears further
+       down intact; the scrolled region shifts up and the rest of the
+       screen is repainted in place */
+    size_t scrolled = 0;
+    for ( size_t y = 0; y < old_rows.size(); y++ ) {
+      if ( *rows[0] == *old_rows[y] ) {
+        scrolled = y;
+        break;
+      }
+    }
+    size_t scroll_height = 0;
+    if ( scrolled ) {
+      while ( ( scrolled + scroll_height < old_rows.size() )
+              && ( *rows[scroll_height] == *old_rows[scrolled + scroll_height] ) ) {
+        scroll_height++;
+      }
+      estimate += INSTRUCTION_OVERHEAD;
+    }
+    const size_t bottom = scrolled + scroll_height; /* one past the scrolling region */
+    size_t incremental = 0;
+    for ( size_t y = scroll_height; y < rows.size(); y++ ) {
+      const Row* source = old_rows[y].get();
+      if ( scrolled && ( y < bottom ) ) {
+        source = ( y + scrolled < bottom ) ? old_rows[y + scrolled].get() : &blank;
+      }
+      if ( rows[y].get() != source ) {
+        incremental += row_damage( *rows[y], *source, run_overhead );
+      }
+    }
+
+    /* ... unless a full repaint is cheaper */
+    size_t repaint = INSTRUCTION_OVERHEAD;
+    for ( size_t y = 0; ( y < rows.size() ) && ( repaint < incremental ); y++ ) {
+      repaint += row_damage( *rows[y], blank, run_overhead );
+    }
+    estimate += std::min( incremental, repaint );
+  }
+
+  if ( fb.get_window_title() != old.get_window_title() ) {
+    estimate += fb.get_window_title().size() + INSTRUCTION_OVERHEAD;
+  }
+  if ( fb.get_icon_name() != old.get_icon_name() ) {
+    estimate += fb.get_icon_name().size() + INSTRUCTION_OVERHEAD;
+  }
+  if ( fb.get_clipboard() != old.get_clipboard() ) {
+    estimate += fb.get_clipboard().size() + INSTRUCTION_OVERHEAD;
+  }
+
+  return estimate;
+}
+
 string Complete::init_diff( void ) const
 {
   return diff_from( Complete( get_fb().ds.get_width(), get_fb().ds.get_height() ) );
 }
 
-void Complete::apply_string( const string& diff )
+void Complete::apply_string( const string& diff, bool general_parser )
 {
   HostBuffers::HostMessage input;
   fatal_assert( input.ParseFromString( diff ) );
 
+  gen = next_gen();
+
   for ( int i = 0; i < input.instruction_size(); i++ ) {
     if ( input.instruction( i ).HasExtension( hostbytes ) ) {
-      string terminal_to_host = act( input.instruction( i ).GetExtension( hostbytes ).hoststring() );
+      const string& hoststring = input.instruction( i ).GetExtension( hostbytes ).hoststring();
+      if ( general_parser ) {
+        act( hoststring );
+      } else {
+        act_hostbytes( hoststring );
+      }
+      string terminal_to_host = terminal.read_octets_to_host();
       assert( terminal_to_host.empty() ); /* server never interrogates client terminal */
     } else if ( input.instruction( i ).HasExtension( resize ) ) {
       act( Resize( input.instruction( i ).GetExtension( resize ).width(),
                    input.instruction( i ).GetExtension( resize ).height() ) );
+    } else if ( input.instruction( i ).HasExtension( frameupdate ) ) {
+      apply_frame_update( input.instruction( i ).GetExtension( frameupdate ), terminal.get_mutable_fb() );
     } else if ( input.instruction( i ).HasExtension( echoack ) ) {
       uint64_t inst_echo_ack_num = input.instruction( i ).GetExtension( echoack ).echo_ack_num();
       assert( inst_echo_ack_num >= echo_ack );
@@ -121,7 +360,17 @@ void Complete::apply_string( const string& diff )
 bool Complete::operator==( Complete const& x ) const
 {
   //  assert( parser == x.parser ); /* parser state is irrelevant for us */
-  return ( terminal == x.terminal ) && ( echo_ack == x.echo_ack );
+  if ( gen == x.gen ) {
+    return true;
+  }
+
+  if ( ( terminal == x.terminal ) && ( echo_ack == x.echo_ack ) ) {
+    /* same contents, so let later comparisons take the shortcut */
+    gen = x.gen = std::min( gen, x.gen );
+    return true;
+  }
+
+  return false;
 }
 
 bool Complete::set_echo_ack( uint64_t now )
@@ -146,6 +395,7 @@ bool Complete::set_echo_ack( uint64_t now )
 
   if ( echo_ack != newest_echo_ack ) {
     ret = true;
+    gen = next_gen();
   }
 
   echo_ack = newest_echo_ack;
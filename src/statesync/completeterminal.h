@@ -35,6 +35,7 @@
 
 #include <cstdint>
 #include <list>
+#include <unordered_set>
 
 #include "src/terminal/parser.h"
 #include "src/terminal/terminal.h"
@@ -58,29 +59,58 @@ private:
   input_history_type input_history;
   uint64_t echo_ack;
 
+  bool cell_diff; /* send the screen as HostBuffers::FrameUpdate, not escape sequences */
+
+  /* Modification generation, copied along with the state.  Every
+     change to the screen or echo ack takes a fresh, globally unique
+     value, so equal generations mean equal states without looking
+     at the framebuffer.  The framebuffer is only reachable through
+     const accessors here, so nothing can change it behind our back. */
+  mutable uint64_t gen;
+  static uint64_t next_gen( void );
+
   static const int ECHO_TIMEOUT = 50; /* for late ack */
 
+  /* host bytes from the server, through Emulator::interpret_hostbytes() where possible */
+  void act_hostbytes( const std::string& str );
+
 public:
   Complete( size_t width, size_t height )
-    : parser(), terminal( width, height ), display( false ), actions(), input_history(), echo_ack( 0 )
+    : parser(), terminal( width, height ), display( false ), actions(), input_history(), echo_ack( 0 ),
+      cell_diff( false ), gen( next_gen() )
   {}
 
   std::string act( const std::string& str );
   std::string act( const Parser::Action& act );
+  std::string act_userbytes( const std::string& bytes ); /* keystrokes from the client */
 
   const Framebuffer& get_fb( void ) const { return terminal.get_fb(); }
   void reset_input( void ) { parser.reset_input(); }
   uint64_t get_echo_ack( void ) const { return echo_ack; }
+  uint64_t get_gen( void ) const { return gen; }
   bool set_echo_ack( uint64_t now );
   void register_input_frame( uint64_t n, uint64_t now );
   int wait_time( uint64_t now ) const;
 
+  /* only once the client has advertised Network::CAPABILITY_CELL_DIFF */
+  void set_cell_diff( bool s_cell_diff ) { cell_diff = s_cell_diff; }
+  bool get_cell_diff( void ) const { return cell_diff; }
+
   /* interface for Network::Transport */
   void subtract( const Complete* ) const {}
   std::string diff_from( const Complete& existing ) const;
+  size_t estimate_diff_size( const Complete& existing ) const;
   std::string init_diff( void ) const;
-  void apply_string( const std::string& diff );
+  void apply_string( const std::string& diff ) { apply_string( diff, false ); }
+  /* general_parser bypasses the host-bytes fast path, to cross-check it */
+  void apply_string( const std::string& diff, bool general_parser );
   bool operator==( const Complete& x ) const;
+  /* approximate bytes held, counting storage already in seen (shared with other states) as free */
+  size_t memory_usage( std::unordered_set<const void*>& seen ) const
+  {
+    return sizeof( *this ) + terminal.memory_usage( seen )
+           + input_history.size() * ( sizeof( input_history_type::value_type ) + 2 * sizeof( void* ) );
+  }
 
   bool compare( const Complete& other ) const;
 };
@@ -0,0 +1,659 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/statesync/framediff.h"
+#include "src/util/fatal_assert.h"
+
+using namespace Terminal;
+using namespace HostBuffers;
+
+/* FrameUpdate.rows is a run of row operations, each
+     varint  rows to leave alone before this one
+     varint  header: row count << 3 | CELLS | BLANK_ROW | MOVED
+     varint  row of the old frame to start from, if MOVED
+     varint  background color of a blank row to start from, if BLANK_ROW
+     varint  length of the spans that follow, if CELLS
+   A row that is neither MOVED nor BLANK_ROW starts from itself.  A run
+   of rows can move or be blanked together; CELLS covers one row.
+
+   The spans change some of the row's cells, each
+     varint  columns to leave alone before the span
+     varint  header: cell count << 4 | TEXT | BLANK | NEW_HYPERLINK | NEW_RENDITION
+     varint  rendition_table index + 1 (0 for the default), if NEW_RENDITION
+     varint  hyperlink_table index + 1 (0 for none), if NEW_HYPERLINK
+   and then the cells:
+     BLANK   nothing; the cells are empty and have no flags
+     TEXT    one UTF-8 character per cell, back to back, no flags
+     neither for every cell,
+               varint  contents length << 3 | WRAP | FALLBACK | WIDE
+               bytes   contents.
+   A span without NEW_RENDITION or NEW_HYPERLINK keeps those of the span
+   before it, across rows; the first span starts from the defaults. */
+
+static const unsigned int MOVED = 1;
+static const unsigned int BLANK_ROW = 2;
+static const unsigned int CELLS = 4;
+static const unsigned int ROW_COUNT_SHIFT = 3;
+
+static const unsigned int NEW_RENDITION = 1;
+static const unsigned int NEW_HYPERLINK = 2;
+static const unsigned int BLANK = 4;
+static const unsigned int TEXT = 8;
+static const unsigned int COUNT_SHIFT = 4;
+
+static const unsigned int WIDE = 1;
+static const unsigned int FALLBACK = 2;
+static const unsigned int WRAP = 4;
+static const unsigned int LENGTH_SHIFT = 3;
+
+static void put_varint( std::string& out, uint64_t n )
+{
+  while ( n >= 0x80 ) {
+    out.push_back( static_cast<char>( ( n & 0x7f ) | 0x80 ) );
+    n >>= 7;
+  }
+  out.push_back( static_cast<char>( n ) );
+}
+
+/* length of the UTF-8 sequence starting with byte, or 0 if it can't start one */
+static size_t utf8_length( unsigned char byte )
+{
+  if ( byte < 0x80 ) {
+    return 1;
+  } else if ( byte < 0xc0 ) {
+    return 0;
+  } else if ( byte < 0xe0 ) {
+    return 2;
+  } else if ( byte < 0xf0 ) {
+    return 3;
+  } else if ( byte < 0xf8 ) {
+    return 4;
+  }
+  return 0;
+}
+
+/* how a span can carry the cell: BLANK, TEXT or with a header of its own (0) */
+static unsigned int cell_kind( const Cell& cell )
+{
+  if ( cell.get_wide() || cell.get_fallback() || cell.get_wrap() ) {
+    return 0;
+  }
+  const std::string& contents = cell.get_contents();
+  if ( contents.empty() ) {
+    return BLANK;
+  }
+  return utf8_length( contents[0] ) == contents.size() ? TEXT : 0;
+}
+
+static color_type row_background( const Row& row )
+{
+  return row.cells.back().get_renditions().get_background_rendition();
+}
+
+static void put_text( const Framebuffer::title_type& text, Text* out )
+{
+  out->mutable_codepoint()->Reserve( text.size() );
+  for ( Framebuffer::title_type::const_iterator i = text.begin(); i != text.end(); i++ ) {
+    out->add_codepoint( *i );
+  }
+}
+
+static Framebuffer::title_type get_text( const Text& text )
+{
+  return Framebuffer::title_type( text.codepoint().begin(), text.codepoint().end() );
+}
+
+namespace {
+/* Renditions and hyperlinks are sent once per update and then named by index */
+class Tables
+{
+private:
+  FrameUpdate& update;
+  std::unordered_map<uint64_t, uint32_t> renditions;
+  std::map<std::pair<std::string, std::string>, uint32_t> hyperlinks;
+
+public:
+  Tables( FrameUpdate& s_update ) : update( s_update ), renditions(), hyperlinks() {}
+
+  uint32_t rendition( const Renditions& r )
+  {
+    if ( r == Renditions( 0 ) ) {
+      return 0;
+    }
+    /* 25 + 25 + 8 bits */
+    const uint64_t key = uint64_t( r.get_foreground_rendition() ) | uint64_t( r.get_background_rendition() ) << 25
+                         | uint64_t( r.get_attributes() ) << 50;
+    std::pair<std::unordered_map<uint64_t, uint32_t>::iterator, bool> slot
+      = renditions.emplace( key, renditions.size() + 1 );
+    if ( slot.second ) {
+      RenditionEntry* entry = update.add_rendition_table();
+      entry->set_foreground( r.get_foreground_rendition() );
+      entry->set_background( r.get_background_rendition() );
+      entry->set_attributes( r.get_attributes() );
+    }
+    return slot.first->second;
+  }
+
+  uint32_t hyperlink( const Hyperlink& h )
+  {
+    if ( h.empty() ) {
+      return 0;
+    }
+    std::pair<std::map<std::pair<std::string, std::string>, uint32_t>::iterator, bool> slot
+      = hyperlinks.emplace( std::make_pair( h.get_params(), h.get_url() ), hyperlinks.size() + 1 );
+    if ( slot.second ) {
+      HyperlinkEntry* entry = update.add_hyperlink_table();
+      entry->set_params( h.get_params() );
+      entry->set_url( h.get_url() );
+    }
+    return slot.first->second;
+  }
+};
+
+/* Writes row operations, joining rows that moved together */
+class RowWriter
+{
+private:
+  std::string& out;
+  int next_row; /* first row not covered yet */
+  int run_row, run_source, run_count;
+
+  void header( int row, uint64_t count, unsigned int flags )
+  {
+    put_varint( out, row - next_row );
+    put_varint( out, count << ROW_COUNT_SHIFT | flags );
+    next_row = row + count;
+  }
+
+public:
+  RowWriter( std::string& s_out ) : out( s_out ), next_row( 0 ), run_row( 0 ), run_source( 0 ), run_count( 0 ) {}
+
+  void move( int row, int source )
+  {
+    if ( run_count && run_row + run_count == row && run_source + run_count == source ) {
+      run_count++;
+      return;
+    }
+    flush();
+    run_row = row;
+    run_source = source;
+    run_count = 1;
+  }
+
+  /* source is the row to start from, or -1 for a blank row */
+  void change( int row, int source, color_type background, const std::string& cells )
+  {
+    flush();
+    unsigned int flags = cells.empty() ? 0 : CELLS;
+    if ( source < 0 ) {
+      flags |= BLANK_ROW;
+    } else if ( source != row ) {
+      flags |= MOVED;
+    }
+    header( row, 1, flags );
+    if ( flags & MOVED ) {
+      put_varint( out, source );
+    }
+    if ( flags & BLANK_ROW ) {
+      put_varint( out, background );
+    }
+    if ( flags & CELLS ) {
+      put_varint( out, cells.size() );
+      out.append( cells );
+    }
+  }
+
+  void flush( void )
+  {
+    if ( run_count ) {
+      header( run_row, run_count, MOVED );
+      put_varint( out, run_source );
+      run_count = 0;
+    }
+  }
+};
+
+class Reader
+{
+private:
+  const char* data;
+  size_t size;
+  size_t pos;
+
+public:
+  Reader( const char* s_data, size_t s_size ) : data( s_data ), size( s_size ), pos( 0 ) {}
+
+  bool done( void ) const { return pos == size; }
+
+  unsigned char peek( void ) const
+  {
+    fatal_assert( pos < size );
+    return data[pos];
+  }
+
+  uint64_t varint( void )
+  {
+    uint64_t n = 0;
+    for ( int shift = 0; shift < 64; shift += 7 ) {
+      fatal_assert( pos < size );
+      const unsigned char byte = data[pos++];
+      n |= uint64_t( byte & 0x7f ) << shift;
+      if ( !( byte & 0x80 ) ) {
+        return n;
+      }
+    }
+    fatal_assert( !"overlong varint" );
+    return 0;
+  }
+
+  const char* bytes( size_t len )
+  {
+    fatal_assert( len <= size - pos );
+    const char* ret = data + pos;
+    pos += len;
+    return ret;
+  }
+};
+}
+
+/* Returns false, leaving out incomplete, once out grows past limit */
+static bool encode_row( const Row& old_row,
+                        const Row& row,
+                        Tables& tables,
+                        uint32_t& rendition,
+                        uint32_t& hyperlink,
+                        std::string& out,
+                        size_t limit = SIZE_MAX )
+{
+  const Row::cells_type& old_cells = old_row.cells;
+  const Row::cells_type& cells = row.cells;
+  const size_t width = cells.size();
+  assert( old_cells.size() == width );
+
+  size_t skip = 0;
+  for ( size_t x = 0; x < width; ) {
+    const Cell& first = cells[x];
+    if ( first == old_cells[x] ) {
+      skip++;
+      x++;
+      continue;
+    }
+
+    /* gather the changed cells that can share a header */
+    const unsigned int kind = cell_kind( first );
+    size_t count = 1;
+    while ( x + count < width ) {
+      const Cell& cell = cells[x + count];
+      if ( cell == old_cells[x + count] || cell_kind( cell ) != kind
+           || !( cell.get_renditions() == first.get_renditions() )
+           || cell.get_hyperlink() != first.get_hyperlink() ) {
+        break;
+      }
+      count++;
+    }
+
+    const uint32_t span_rendition = tables.rendition( first.get_renditions() );
+    const uint32_t span_hyperlink = tables.hyperlink( first.get_hyperlink() );
+    uint64_t header = uint64_t( count ) << COUNT_SHIFT | kind;
+    if ( span_rendition != rendition ) {
+      header |= NEW_RENDITION;
+    }
+    if ( span_hyperlink != hyperlink ) {
+      header |= NEW_HYPERLINK;
+    }
+
+    put_varint( out, skip );
+    put_varint( out, header );
+    if ( header & NEW_RENDITION ) {
+      put_varint( out, span_rendition );
+      rendition = span_rendition;
+    }
+    if ( header & NEW_HYPERLINK ) {
+      put_varint( out, span_hyperlink );
+      hyperlink = span_hyperlink;
+    }
+    if ( kind == TEXT ) {
+      for ( size_t i = x; i < x + count; i++ ) {
+        out.append( cells[i].get_contents() );
+      }
+    } else if ( kind == 0 ) {
+      for ( size_t i = x; i < x + count; i++ ) {
+        const std::string& contents = cells[i].get_contents();
+        put_varint( out,
+                    uint64_t( contents.size() ) << LENGTH_SHIFT | ( cells[i].get_wide() ? WIDE : 0 )
+                      | ( cells[i].get_fallback() ? FALLBACK : 0 ) | ( cells[i].get_wrap() ? WRAP : 0 ) );
+        out.append( contents );
+      }
+    }
+
+    x += count;
+    skip = 0;
+    if ( out.size() > limit ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void apply_row( Reader& reader,
+                       const std::vector<Renditions>& renditions,
+                       const std::vector<Hyperlink>& hyperlinks,
+                       uint32_t& rendition,
+                       uint32_t& hyperlink,
+                       Row::cells_type& cells )
+{
+  size_t x = 0;
+  while ( !reader.done() ) {
+    x += reader.varint();
+    const uint64_t header = reader.varint();
+    if ( header & NEW_RENDITION ) {
+      rendition = reader.varint();
+      fatal_assert( rendition < renditions.size() );
+    }
+    if ( header & NEW_HYPERLINK ) {
+      hyperlink = reader.varint();
+      fatal_assert( hyperlink < hyperlinks.size() );
+    }
+
+    const uint64_t count = header >> COUNT_SHIFT;
+    fatal_assert( x <= cells.size() && count <= cells.size() - x );
+    for ( size_t end = x + count; x < end; x++ ) {
+      Cell& cell = cells[x];
+      if ( header & ( BLANK | TEXT ) ) {
+        if ( header & BLANK ) {
+          cell.clear();
+        } else {
+          const size_t length = utf8_length( reader.peek() );
+          fatal_assert( length );
+          cell.set_contents( reader.bytes( length ), length );
+        }
+        cell.set_wide( false );
+        cell.set_fallback( false );
+        cell.set_wrap( false );
+      } else {
+        const uint64_t flags = reader.varint();
+        const uint64_t length = flags >> LENGTH_SHIFT;
+        cell.set_contents( reader.bytes( length ), length );
+        cell.set_wide( flags & WIDE );
+        cell.set_fallback( flags & FALLBACK );
+        cell.set_wrap( flags & WRAP );
+      }
+      cell.set_renditions( renditions[rendition] );
+      cell.set_hyperlink( hyperlinks[hyperlink] );
+    }
+  }
+}
+
+void Terminal::encode_frame_update( const Framebuffer& last, const Framebuffer& f, FrameUpdate& update )
+{
+  const int height = f.ds.get_height();
+  assert( last.ds.get_width() == f.ds.get_width() && last.ds.get_height() == height );
+
+  Tables tables( update );
+  uint32_t rendition = 0, hyperlink = 0;
+
+  /* Rows keep their generation number when copied, so a row of f that
+     started life as some other row of last (after a scroll, say) can
+     be sent as changes to that row. */
+  std::unordered_map<uint64_t, int> last_rows;
+  for ( int y = height - 1; y >= 0; y-- ) {
+    last_rows[last.get_row( y )->gen] = y;
+  }
+  Framebuffer::row_pointer blank_row;
+
+  std::string rows;
+  RowWriter writer( rows );
+  for ( int y = 0; y < height; y++ ) {
+    const Row* row = f.get_row( y );
+    if ( row == last.get_row( y ) ) {
+      continue;
+    }
+
+    int source = y;
+    bool fresh = false;
+    if ( row->gen != last.get_row( y )->gen ) {
+      std::unordered_map<uint64_t, int>::const_iterator i = last_rows.find( row->gen );
+      if ( i != last_rows.end() ) {
+        source = i->second;
+      } else {
+        fresh = true;
+      }
+    }
+
+    if ( fresh ) {
+      /* The row is new since last, so it started out blank.  Send it
+         that way unless it is much like the row it replaced. */
+      const color_type background = row_background( *row );
+      if ( !blank_row || row_background( *blank_row ) != background ) {
+        blank_row = std::make_shared<Row>( f.ds.get_width(), background );
+      }
+      uint32_t blank_rendition = rendition, blank_hyperlink = hyperlink;
+      std::string blank_cells;
+      encode_row( *blank_row, *row, tables, blank_rendition, blank_hyperlink, blank_cells );
+
+      uint32_t old_rendition = rendition, old_hyperlink = hyperlink;
+      std::string old_cells;
+      /* a blank row costs a couple of bytes to set up */
+      if ( !encode_row(
+             *last.get_row( y ), *row, tables, old_rendition, old_hyperlink, old_cells, blank_cells.size() + 2 ) ) {
+        writer.change( y, -1, background, blank_cells );
+        rendition = blank_rendition;
+        hyperlink = blank_hyperlink;
+        continue;
+      }
+      rendition = old_rendition;
+      hyperlink = old_hyperlink;
+      if ( !old_cells.empty() ) {
+        writer.change( y, y, 0, old_cells );
+      }
+      continue;
+    }
+
+    std::string cells;
+    encode_row( *last.get_row( source ), *row, tables, rendition, hyperlink, cells );
+
+    if ( cells.empty() ) {
+      if ( source != y ) {
+        writer.move( y, source );
+      }
+    } else {
+      writer.change( y, source, 0, cells );
+    }
+  }
+  writer.flush();
+  if ( !rows.empty() ) {
+    update.set_rows( rows );
+  }
+
+  const DrawState& ds = f.ds;
+  const DrawState& last_ds = last.ds;
+  if ( ds.get_cursor_row() != last_ds.get_cursor_row() ) {
+    update.set_cursor_row( ds.get_cursor_row() );
+  }
+  if ( ds.get_cursor_col() != last_ds.get_cursor_col() ) {
+    update.set_cursor_col( ds.get_cursor_col() );
+  }
+  if ( ds.cursor_visible != last_ds.cursor_visible ) {
+    update.set_cursor_visible( ds.cursor_visible );
+  }
+  if ( !( ds.get_renditions() == last_ds.get_renditions() ) ) {
+    update.set_current_rendition( tables.rendition( ds.get_renditions() ) );
+  }
+  if ( ds.get_hyperlink() != last_ds.get_hyperlink() ) {
+    update.set_current_hyperlink( tables.hyperlink( ds.get_hyperlink() ) );
+  }
+  if ( ds.reverse_video != last_ds.reverse_video ) {
+    update.set_reverse_video( ds.reverse_video );
+  }
+  if ( ds.bracketed_paste != last_ds.bracketed_paste ) {
+    update.set_bracketed_paste( ds.bracketed_paste );
+  }
+  if ( ds.mouse_reporting_mode != last_ds.mouse_reporting_mode ) {
+    update.set_mouse_reporting_mode( ds.mouse_reporting_mode );
+  }
+  if ( ds.mouse_focus_event != last_ds.mouse_focus_event ) {
+    update.set_mouse_focus_event( ds.mouse_focus_event );
+  }
+  if ( ds.mouse_alternate_scroll != last_ds.mouse_alternate_scroll ) {
+    update.set_mouse_alternate_scroll( ds.mouse_alternate_scroll );
+  }
+  if ( ds.mouse_encoding_mode != last_ds.mouse_encoding_mode ) {
+    update.set_mouse_encoding_mode( ds.mouse_encoding_mode );
+  }
+
+  if ( f.is_title_initialized() && !last.is_title_initialized() ) {
+    update.set_title_initialized( true );
+  }
+  if ( f.get_icon_name() != last.get_icon_name() ) {
+    put_text( f.get_icon_name(), update.mutable_icon_name() );
+  }
+  if ( f.get_window_title() != last.get_window_title() ) {
+    put_text( f.get_window_title(), update.mutable_window_title() );
+  }
+  if ( f.get_clipboard() != last.get_clipboard() ) {
+    put_text( f.get_clipboard(), update.mutable_clipboard() );
+  }
+  if ( f.get_bell_count() != last.get_bell_count() ) {
+    update.set_bell_count( f.get_bell_count() );
+  }
+}
+
+void Terminal::apply_frame_update( const FrameUpdate& update, Framebuffer& fb )
+{
+  std::vector<Renditions> renditions( 1, Renditions( 0 ) ); /* index 0 is the default */
+  renditions.reserve( update.rendition_table_size() + 1 );
+  for ( int i = 0; i < update.rendition_table_size(); i++ ) {
+    const RenditionEntry& entry = update.rendition_table( i );
+    renditions.push_back( Renditions( entry.foreground(), entry.background(), entry.attributes() ) );
+  }
+  std::vector<Hyperlink> hyperlinks( 1 ); /* index 0 is no hyperlink */
+  for ( int i = 0; i < update.hyperlink_table_size(); i++ ) {
+    const HyperlinkEntry& entry = update.hyperlink_table( i );
+    hyperlinks.push_back( Hyperlink( entry.params(), entry.url() ) );
+  }
+
+  /* moved rows come from the frame as it was before this update */
+  const Framebuffer::rows_type last_rows( fb.get_rows() );
+  const uint64_t height = last_rows.size();
+  uint32_t rendition = 0, hyperlink = 0;
+
+  Reader reader( update.rows().data(), update.rows().size() );
+  uint64_t y = 0;
+  while ( !reader.done() ) {
+    y += reader.varint();
+    const uint64_t header = reader.varint();
+    const uint64_t count = header >> ROW_COUNT_SHIFT;
+    fatal_assert( y <= height && count <= height - y );
+
+    if ( header & MOVED ) {
+      const uint64_t source = reader.varint();
+      fatal_assert( source <= height && count <= height - source );
+      for ( uint64_t i = 0; i < count; i++ ) {
+        fb.set_row( y + i, last_rows[source + i] );
+      }
+    } else if ( header & BLANK_ROW ) {
+      const color_type background = reader.varint();
+      for ( uint64_t i = 0; i < count; i++ ) {
+        fb.set_row( y + i, std::make_shared<Row>( fb.ds.get_width(), background ) );
+      }
+    }
+
+    if ( header & CELLS ) {
+      fatal_assert( count == 1 );
+      const uint64_t length = reader.varint();
+      Reader cells( reader.bytes( length ), length );
+      apply_row( cells, renditions, hyperlinks, rendition, hyperlink, fb.get_mutable_row( y )->cells );
+    }
+
+    y += count;
+  }
+
+  DrawState& ds = fb.ds;
+  if ( update.has_cursor_row() ) {
+    ds.move_row( update.cursor_row() );
+  }
+  if ( update.has_cursor_col() ) {
+    ds.move_col( update.cursor_col() );
+  }
+  if ( update.has_cursor_visible() ) {
+    ds.cursor_visible = update.cursor_visible();
+  }
+  if ( update.has_current_rendition() ) {
+    fatal_assert( update.current_rendition() < renditions.size() );
+    ds.get_renditions() = renditions[update.current_rendition()];
+  }
+  if ( update.has_current_hyperlink() ) {
+    fatal_assert( update.current_hyperlink() < hyperlinks.size() );
+    ds.set_hyperlink( hyperlinks[update.current_hyperlink()] );
+  }
+  if ( update.has_reverse_video() ) {
+    ds.reverse_video = update.reverse_video();
+  }
+  if ( update.has_bracketed_paste() ) {
+    ds.bracketed_paste = update.bracketed_paste();
+  }
+  if ( update.has_mouse_reporting_mode() ) {
+    ds.mouse_reporting_mode = static_cast<DrawState::MouseReportingMode>( update.mouse_reporting_mode() );
+  }
+  if ( update.has_mouse_focus_event() ) {
+    ds.mouse_focus_event = update.mouse_focus_event();
+  }
+  if ( update.has_mouse_alternate_scroll() ) {
+    ds.mouse_alternate_scroll = update.mouse_alternate_scroll();
+  }
+  if ( update.has_mouse_encoding_mode() ) {
+    ds.mouse_encoding_mode = static_cast<DrawState::MouseEncodingMode>( update.mouse_encoding_mode() );
+  }
+
+  if ( update.title_initialized() ) {
+    fb.set_title_initialized();
+  }
+  if ( update.has_icon_name() ) {
+    fb.set_icon_name( get_text( update.icon_name() ) );
+  }
+  if ( update.has_window_title() ) {
+    fb.set_window_title( get_text( update.window_title() ) );
+  }
+  if ( update.has_clipboard() ) {
+    fb.set_clipboard( get_text( update.clipboard() ) );
+  }
+  if ( update.has_bell_count() ) {
+    fb.set_bell_count( update.bell_count() );
+  }
+}
@@ -0,0 +1,50 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#ifndef FRAME_DIFF_HPP
+#define FRAME_DIFF_HPP
+
+#include "src/protobufs/hostinput.pb.h"
+#include "src/terminal/terminalframebuffer.h"
+
+/* Screen updates as data (HostBuffers::FrameUpdate) instead of the
+   escape sequences from Display::new_frame().  The client applies them
+   straight to its Framebuffer, without a trip through the Parser. */
+
+namespace Terminal {
+/* Describes how to turn last into f.  last must already be f's size. */
+void encode_frame_update( const Framebuffer& last, const Framebuffer& f, HostBuffers::FrameUpdate& update );
+
+void apply_frame_update( const HostBuffers::FrameUpdate& update, Framebuffer& fb );
+}
+
+#endif
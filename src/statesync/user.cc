@@ -30,6 +30,7 @@
     also delete it here.
 */
 
+#include <algorithm>
 #include <cassert>
 #include <typeinfo>
 
@@ -41,47 +42,86 @@ using namespace Parser;
 using namespace Network;
 using namespace ClientBuffers;
 
+uint64_t UserStream::next_gen( void )
+{
+  static uint64_t gen_counter = 0;
+  return ++gen_counter;
+}
+
+void UserStream::append_bytes( const char* s, size_t len )
+{
+  gen = next_gen();
+  event_count += len;
+  while ( len > 0 ) {
+    if ( chunks.empty() || ( chunks.back().type != UserByteType )
+         || ( chunks.back().bytes.size() >= CHUNK_SIZE ) ) {
+      chunks.push_back( UserChunk( std::string() ) );
+    }
+    std::string& run = chunks.back().bytes;
+    const size_t n = std::min( len, CHUNK_SIZE - run.size() );
+    run.append( s, n );
+    s += n;
+    len -= n;
+  }
+}
+
+/* Keeps the generation: the transport drops the same prefix from every
+   state it holds, so diffs between them, and its cache of them, stay
+   valid. */
 void UserStream::subtract( const UserStream* prefix )
 {
   // if we are subtracting ourself from ourself, just clear the std::deque
   if ( this == prefix ) {
-    actions.clear();
+    chunks.clear();
+    event_count = 0;
     return;
   }
-  for ( std::deque<UserEvent>::const_iterator i = prefix->actions.begin(); i != prefix->actions.end(); i++ ) {
-    assert( this != prefix );
-    assert( !actions.empty() );
-    assert( *i == actions.front() );
-    actions.pop_front();
+
+  assert( prefix->event_count <= event_count );
+  size_t remaining = prefix->event_count;
+  event_count -= remaining;
+  while ( remaining > 0 ) {
+    assert( !chunks.empty() );
+    UserChunk& front = chunks.front();
+    if ( front.size() <= remaining ) {
+      remaining -= front.size();
+      chunks.pop_front();
+    } else {
+      assert( front.type == UserByteType );
+      front.bytes.erase( 0, remaining );
+      remaining = 0;
+    }
   }
 }
 
 std::string UserStream::diff_from( const UserStream& existing ) const
 {
-  std::deque<UserEvent>::const_iterator my_it = actions.begin();
+  assert( existing.event_count <= event_count );
 
-  for ( std::deque<UserEvent>::const_iterator i = existing.actions.begin(); i != existing.actions.end(); i++ ) {
-    assert( my_it != actions.end() );
-    assert( *i == *my_it );
+  /* skip the events the receiver already has */
+  std::deque<UserChunk>::const_iterator my_it = chunks.begin();
+  size_t offset = existing.event_count;
+  while ( ( my_it != chunks.end() ) && ( offset >= my_it->size() ) ) {
+    offset -= my_it->size();
     my_it++;
   }
 
   ClientBuffers::UserMessage output;
 
-  while ( my_it != actions.end() ) {
+  for ( ; my_it != chunks.end(); my_it++, offset = 0 ) {
     switch ( my_it->type ) {
       case UserByteType: {
-        char the_byte = my_it->userbyte.c;
         /* can we combine this with a previous Keystroke? */
         if ( ( output.instruction_size() > 0 )
              && ( output.instruction( output.instruction_size() - 1 ).HasExtension( keystroke ) ) ) {
           output.mutable_instruction( output.instruction_size() - 1 )
             ->MutableExtension( keystroke )
             ->mutable_keys()
-            ->append( std::string( &the_byte, 1 ) );
+            ->append( my_it->bytes, offset, std::string::npos );
         } else {
           Instruction* new_inst = output.add_instruction();
-          new_inst->MutableExtension( keystroke )->set_keys( &the_byte, 1 );
+          new_inst->MutableExtension( keystroke )
+            ->set_keys( my_it->bytes.data() + offset, my_it->bytes.size() - offset );
         }
       } break;
       case ResizeType: {
@@ -93,13 +133,25 @@ std::string UserStream::diff_from( const UserStream& existing ) const
         assert( !"unexpected event type" );
         break;
     }
-
-    my_it++;
   }
 
   return output.SerializeAsString();
 }
 
+/* existing must be a prefix, as for diff_from() */
+size_t UserStream::estimate_diff_size( const UserStream& existing ) const
+{
+  static const size_t RESIZE_SIZE = 10; /* instruction with two varints */
+  size_t new_events = event_count - existing.event_count;
+  size_t estimate = 0;
+  for ( std::deque<UserChunk>::const_reverse_iterator i = chunks.rbegin(); new_events > 0; i++ ) {
+    const size_t n = std::min( new_events, i->size() );
+    estimate += ( i->type == ResizeType ) ? RESIZE_SIZE : n;
+    new_events -= n;
+  }
+  return estimate;
+}
+
 void UserStream::apply_string( const std::string& diff )
 {
   ClientBuffers::UserMessage input;
@@ -107,27 +159,62 @@ void UserStream::apply_string( const std::string& diff )
 
   for ( int i = 0; i < input.instruction_size(); i++ ) {
     if ( input.instruction( i ).HasExtension( keystroke ) ) {
-      std::string the_bytes = input.instruction( i ).GetExtension( keystroke ).keys();
-      for ( unsigned int loc = 0; loc < the_bytes.size(); loc++ ) {
-        actions.push_back( UserEvent( UserByte( the_bytes.at( loc ) ) ) );
-      }
+      const std::string& the_bytes = input.instruction( i ).GetExtension( keystroke ).keys();
+      append_bytes( the_bytes.data(), the_bytes.size() );
     } else if ( input.instruction( i ).HasExtension( resize ) ) {
-      actions.push_back( UserEvent( Resize( input.instruction( i ).GetExtension( resize ).width(),
-                                            input.instruction( i ).GetExtension( resize ).height() ) ) );
+      push_back( Resize( input.instruction( i ).GetExtension( resize ).width(),
+                         input.instruction( i ).GetExtension( resize ).height() ) );
     }
   }
 }
 
-const Parser::Action& UserStream::get_action( unsigned int i ) const
+/* nothing is shared between UserStreams */
+size_t UserStream::memory_usage( std::unordered_set<const void*>& seen __attribute( ( unused ) ) ) const
+{
+  size_t total = sizeof( *this ) + chunks.size() * sizeof( UserChunk );
+  for ( std::deque<UserChunk>::const_iterator i = chunks.begin(); i != chunks.end(); i++ ) {
+    total += i->bytes.capacity();
+  }
+  return total;
+}
+
+bool UserStream::operator==( const UserStream& x ) const
 {
-  switch ( actions[i].type ) {
-    case UserByteType:
-      return actions[i].userbyte;
-    case ResizeType:
-      return actions[i].resize;
-    default:
-      assert( !"unexpected action type" );
-      static const Parser::Ignore nothing = Parser::Ignore();
-      return nothing;
+  if ( event_count != x.event_count ) {
+    return false;
   }
+
+  /* the same events may be chunked differently */
+  std::deque<UserChunk>::const_iterator a = chunks.begin(), b = x.chunks.begin();
+  size_t a_offset = 0, b_offset = 0;
+  while ( ( a != chunks.end() ) && ( b != x.chunks.end() ) ) {
+    if ( a->type != b->type ) {
+      return false;
+    }
+    if ( a->type == ResizeType ) {
+      if ( !( a->resize == b->resize ) ) {
+        return false;
+      }
+      a++;
+      b++;
+      continue;
+    }
+
+    const size_t n = std::min( a->bytes.size() - a_offset, b->bytes.size() - b_offset );
+    if ( a->bytes.compare( a_offset, n, b->bytes, b_offset, n ) != 0 ) {
+      return false;
+    }
+    a_offset += n;
+    b_offset += n;
+    if ( a_offset == a->bytes.size() ) {
+      a++;
+      a_offset = 0;
+    }
+    if ( b_offset == b->bytes.size() ) {
+      b++;
+      b_offset = 0;
+    }
+  }
+
+  return ( a == chunks.end() ) && ( b == x.chunks.end() );
 }
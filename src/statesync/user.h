@@ -37,6 +37,7 @@
 #include <deque>
 #include <list>
 #include <string>
+#include <unordered_set>
 
 #include "src/terminal/parseraction.h"
 
@@ -47,48 +48,72 @@ enum UserEventType
   ResizeType = 1
 };
 
-class UserEvent
+/* A run of consecutive keystroke bytes, or one resize */
+class UserChunk
 {
 public:
   UserEventType type;
-  Parser::UserByte userbyte;
+  std::string bytes;
   Parser::Resize resize;
 
-  UserEvent( const Parser::UserByte& s_userbyte ) : type( UserByteType ), userbyte( s_userbyte ), resize( -1, -1 )
-  {}
-  UserEvent( const Parser::Resize& s_resize ) : type( ResizeType ), userbyte( 0 ), resize( s_resize ) {}
+  UserChunk( const std::string& s_bytes ) : type( UserByteType ), bytes( s_bytes ), resize( -1, -1 ) {}
+  UserChunk( const Parser::Resize& s_resize ) : type( ResizeType ), bytes(), resize( s_resize ) {}
 
-private:
-  UserEvent();
+  /* number of events */
+  size_t size( void ) const { return type == UserByteType ? bytes.size() : 1; }
 
-public:
-  bool operator==( const UserEvent& x ) const
-  {
-    return ( type == x.type ) && ( userbyte == x.userbyte ) && ( resize == x.resize );
-  }
+private:
+  UserChunk();
 };
 
 class UserStream
 {
 private:
-  std::deque<UserEvent> actions;
+  /* Events are kept as chunks so that a large paste costs O(chunks),
+     not O(bytes), to subtract, diff and compare.  Byte runs are capped
+     so that subtracting part of one stays cheap. */
+  static const size_t CHUNK_SIZE = 4096;
+
+  std::deque<UserChunk> chunks;
+  size_t event_count;
+
+  /* Modification generation, copied along with the stream; every
+     new event takes a fresh value.  Streams of equal generation are
+     equal once the same prefix is subtracted from each. */
+  uint64_t gen;
+  static uint64_t next_gen( void );
+
+  void append_bytes( const char* s, size_t len );
 
 public:
-  UserStream() : actions() {}
+  UserStream() : chunks(), event_count( 0 ), gen( next_gen() ) {}
 
-  void push_back( const Parser::UserByte& s_userbyte ) { actions.push_back( UserEvent( s_userbyte ) ); }
-  void push_back( const Parser::Resize& s_resize ) { actions.push_back( UserEvent( s_resize ) ); }
+  void push_back( const Parser::UserByte& s_userbyte ) { append_bytes( &s_userbyte.c, 1 ); }
+  void push_back( const Parser::Resize& s_resize )
+  {
+    chunks.push_back( UserChunk( s_resize ) );
+    event_count++;
+    gen = next_gen();
+  }
 
-  bool empty( void ) const { return actions.empty(); }
-  size_t size( void ) const { return actions.size(); }
-  const Parser::Action& get_action( unsigned int i ) const;
+  bool empty( void ) const { return event_count == 0; }
+  size_t size( void ) const { return event_count; }
+  uint64_t get_gen( void ) const { return gen; }
+  size_t chunk_count( void ) const { return chunks.size(); }
+  const UserChunk& get_chunk( size_t i ) const { return chunks[i]; }
 
   /* interface for Network::Transport */
   void subtract( const UserStream* prefix );
   std::string diff_from( const UserStream& existing ) const;
+  size_t estimate_diff_size( const UserStream& existing ) const;
   std::string init_diff( void ) const { return diff_from( UserStream() ); };
   void apply_string( const std::string& diff );
-  bool operator==( const UserStream& x ) const { return actions == x.actions; }
+  void apply_string( const std::string& diff, bool general_parser __attribute( ( unused ) ) )
+  {
+    apply_string( diff ); /* only one decoder */
+  }
+  bool operator==( const UserStream& x ) const;
+  size_t memory_usage( std::unordered_set<const void*>& seen ) const;
 
   bool compare( const UserStream& ) { return false; }
 };
@@ -62,6 +62,8 @@ public:
   void input( wchar_t ch, Actions& actions );
 
   void reset_input( void ) { state = &family.s_Ground; }
+
+  bool is_ground( void ) const { return state == &family.s_Ground; }
 };
 
 static const size_t BUF_SIZE = 8;
@@ -85,6 +87,9 @@ public:
     buf[0] = '\0';
     buf_len = 0;
   }
+
+  /* true between escape sequences and characters, when no input is pending */
+  bool is_ground( void ) const { return ( buf_len == 0 ) && parser.is_ground(); }
 };
 }
 
@@ -45,11 +45,16 @@ Emulator::Emulator( size_t s_width, size_t s_height ) : fb( s_width, s_height ),
 
 std::string Emulator::read_octets_to_host( void )
 {
-  std::string ret = dispatch.terminal_to_host;
-  dispatch.terminal_to_host.clear();
+  std::string ret;
+  ret.swap( dispatch.terminal_to_host );
   return ret;
 }
 
+void Emulator::user_input( const char* str, size_t len )
+{
+  user.input( str, len, fb.ds.application_mode_cursor_keys, dispatch.terminal_to_host );
+}
+
 void Emulator::execute( const Parser::Execute* act )
 {
   dispatch.dispatch( CONTROL, act, &fb );
@@ -152,6 +157,8 @@ void Emulator::CSI_dispatch( const Parser::CSI_Dispatch* act )
 void Emulator::OSC_end( const Parser::OSC_End* act )
 {
   dispatch.OSC_dispatch( act, &fb );
+  /* don't carry the payload along in every copy of this Emulator */
+  dispatch.OSC_release();
 }
 
 void Emulator::Esc_dispatch( const Parser::Esc_Dispatch* act )
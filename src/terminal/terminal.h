@@ -74,12 +74,31 @@ private:
   void OSC_end( const Parser::OSC_End* act );
   void resize( size_t s_width, size_t s_height );
 
+  /* helpers for interpret_hostbytes() */
+  size_t interpret_CSI( const unsigned char* str, size_t len );
+  size_t interpret_OSC( const unsigned char* str, size_t len );
+
 public:
   Emulator( size_t s_width, size_t s_height );
 
   std::string read_octets_to_host( void );
 
+  /* Equivalent to a Parser::UserByte action for each byte of str */
+  void user_input( const char* str, size_t len );
+
+  /* Interpret the subset of escape sequences that Display::new_frame() produces, without
+     going through the Parser.  Returns the number of bytes consumed, stopping at the
+     first byte that needs the general path. */
+  size_t interpret_hostbytes( const char* str, size_t len );
+
   const Framebuffer& get_fb( void ) const { return fb; }
+  Framebuffer& get_mutable_fb( void ) { return fb; }
+
+  /* approximate heap footprint, counting storage already in seen as free */
+  size_t memory_usage( std::unordered_set<const void*>& seen ) const
+  {
+    return fb.memory_usage( seen ) + dispatch.memory_usage();
+  }
 
   bool operator==( Emulator const& x ) const;
 };
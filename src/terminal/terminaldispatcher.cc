@@ -250,6 +250,12 @@ void Dispatcher::OSC_start( const Parser::OSC_Start* act __attribute( ( unused )
   OSC_string.clear();
 }
 
+size_t Dispatcher::memory_usage( void ) const
+{
+  return params.capacity() + dispatch_chars.capacity() + terminal_to_host.capacity()
+         + parsed_params.capacity() * sizeof( int ) + OSC_string.capacity() * sizeof( wchar_t );
+}
+
 bool Dispatcher::operator==( const Dispatcher& x ) const
 {
   return ( params == x.params ) && ( parsed_params == x.parsed_params ) && ( parsed == x.parsed )
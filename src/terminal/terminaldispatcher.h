@@ -122,6 +122,9 @@ public:
   void OSC_put( const Parser::OSC_Put* act );
   void OSC_start( const Parser::OSC_Start* act );
   void OSC_dispatch( const Parser::OSC_End* act, Framebuffer* fb );
+  void OSC_release( void ) { std::vector<wchar_t>().swap( OSC_string ); } /* up to a clipboard's worth */
+
+  size_t memory_usage( void ) const; /* approximate heap footprint */
 
   bool operator==( const Dispatcher& x ) const;
 };
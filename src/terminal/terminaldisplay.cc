@@ -30,9 +30,13 @@
     also delete it here.
 */
 
+#include <algorithm>
 #include <cstdio>
+#include <deque>
+#include <vector>
 
 #include "src/terminal/terminalframebuffer.h"
+#include "src/util/workerpool.h"
 #include "terminaldisplay.h"
 
 using namespace Terminal;
@@ -58,10 +62,99 @@ std::string Display::close() const
          + std::string( rmcup ? rmcup : "" );
 }
 
+static FrameStrategyStats strategy_stats;
+
+/* Below this many cells, waking other threads costs more than it saves. */
+int Display::parallel_threshold = 40000;
+int Display::parallel_bands = 0;
+
+const FrameStrategyStats& Display::get_strategy_stats( void )
+{
+  return strategy_stats;
+}
+
+void Display::print_strategy_stats( FILE* out )
+{
+  fprintf( out,
+           "Frames: %llu incremental, %llu repainted (%llu bytes saved), %llu repaints rejected.\n",
+           static_cast<unsigned long long>( strategy_stats.incremental ),
+           static_cast<unsigned long long>( strategy_stats.repaint ),
+           static_cast<unsigned long long>( strategy_stats.bytes_saved ),
+           static_cast<unsigned long long>( strategy_stats.repaint_rejected ) );
+}
+
+/* Rough byte cost of clearing the screen and repainting f, from a sample of rows */
+size_t Display::estimate_repaint_size( const Framebuffer& f )
+{
+  const int SGR_COST = 8;
+  const int MOVE_COST = 6;
+  const Cell blank( 0 );
+  const int height = f.ds.get_height();
+  const int stride = height > 8 ? height / 8 : 1;
+  size_t sampled_bytes = 0;
+  int sampled_rows = 0;
+
+  for ( int y = 0; y < height; y += stride ) {
+    const Row::cells_type& cells = f.get_row( y )->cells;
+    const Renditions* rendition = &initial_rendition();
+    size_t row_bytes = 0;
+    int gap = 0;
+    for ( Row::cells_type::const_iterator i = cells.begin(); i != cells.end(); i++ ) {
+      /* blank cells are left alone after the screen is cleared */
+      if ( *i == blank ) {
+        gap++;
+        continue;
+      }
+      if ( !( i->get_renditions() == *rendition ) ) {
+        rendition = &i->get_renditions();
+        row_bytes += SGR_COST;
+      }
+      row_bytes += 1 + std::min( gap, MOVE_COST );
+      gap = 0;
+    }
+    if ( row_bytes ) {
+      sampled_bytes += row_bytes + MOVE_COST;
+    }
+    sampled_rows++;
+  }
+
+  /* clear screen, modes and cursor placement */
+  return 32 + sampled_bytes * height / sampled_rows;
+}
+
 std::string Display::new_frame( bool initialized, const Framebuffer& last, const Framebuffer& f ) const
 {
   FrameState frame( last );
 
+  if ( !paint( initialized, frame, f ) ) {
+    return frame.str; /* already a repaint */
+  }
+
+  /* When most rows changed (a TUI redrawing after clear, say), the
+     incremental diff can be bigger than clearing the screen and
+     painting it again.  Only pay for a second paint when a cheap
+     estimate says the repaint might win. */
+  if ( frame.rows_drawn * 2 < f.ds.get_height() || estimate_repaint_size( f ) >= frame.str.size() ) {
+    strategy_stats.incremental++;
+    return frame.str;
+  }
+
+  FrameState repaint( last );
+  paint( true, repaint, f, true );
+  if ( repaint.str.size() < frame.str.size() ) {
+    strategy_stats.repaint++;
+    strategy_stats.bytes_saved += frame.str.size() - repaint.str.size();
+    return repaint.str;
+  }
+
+  strategy_stats.repaint_rejected++;
+  return frame.str;
+}
+
+/* Paint f over the last frame.  With clear_first, clear the screen before
+   drawing.  Returns false if a resize forced painting from scratch. */
+bool Display::paint( bool initialized, FrameState& frame, const Framebuffer& f, bool clear_first ) const
+{
   char tmp[64];
 
   /* has bell been rung? */
@@ -138,6 +231,14 @@ std::string Display::new_frame( bool initialized, const Framebuffer& last, const
     frame.current_hyperlink = frame.last_frame.ds.get_hyperlink();
   }
 
+  if ( clear_first ) {
+    /* clear the screen, then draw only what differs from a blank screen */
+    frame.update_hyperlink( Hyperlink() );
+    frame.append( "\033[r\033[0m\033[H\033[2J" );
+    frame.cursor_x = frame.cursor_y = 0;
+    frame.current_rendition = initial_rendition();
+  }
+
   /* is cursor visibility initialized? */
   if ( !initialized ) {
     frame.cursor_visible = false;
@@ -162,9 +263,13 @@ std::string Display::new_frame( bool initialized, const Framebuffer& last, const
     blank_row = std::make_shared<Row>( w, c );
     rows.resize( f.ds.get_height(), blank_row );
   }
+  if ( clear_first ) {
+    blank_row = std::make_shared<Row>( f.ds.get_width(), 0 );
+    rows.assign( f.ds.get_height(), blank_row );
+  }
 
   /* shortcut -- has display moved up by a certain number of lines? */
-  if ( initialized ) {
+  if ( initialized && !clear_first ) {
     int lines_scrolled = 0;
     int scroll_height = 0;
 
@@ -250,9 +355,14 @@ std::string Display::new_frame( bool initialized, const Framebuffer& last, const
   }
 
   /* Now update the display, row by row */
-  bool wrap = false;
-  for ( ; frame_y < f.ds.get_height(); frame_y++ ) {
-    wrap = put_row( initialized, frame, f, frame_y, *rows.at( frame_y ), wrap );
+  if ( f.ds.get_width() * ( f.ds.get_height() - frame_y ) >= parallel_threshold
+       && ( parallel_bands ? parallel_bands : static_cast<int>( WorkerPool::get_instance().size() ) ) > 1 ) {
+    put_rows_in_bands( initialized, frame, f, rows, frame_y );
+  } else {
+    bool wrap = false;
+    for ( ; frame_y < f.ds.get_height(); frame_y++ ) {
+      wrap = put_row( initialized, frame, f, frame_y, *rows.at( frame_y ), wrap );
+    }
   }
 
   /* has cursor location changed? */
@@ -318,7 +428,107 @@ std::string Display::new_frame( bool initialized, const Framebuffer& last, const
     }
   }
 
-  return frame.str;
+  return initialized;
+}
+
+/* Where a band stood after one of its rows */
+class BandMark
+{
+public:
+  size_t offset;
+  int rows_drawn;
+  int cursor_x, cursor_y;
+  bool cursor_visible;
+  bool known; /* cursor, rendition and hyperlink all known */
+  Renditions rendition;
+  Hyperlink hyperlink;
+
+  BandMark( const FrameState& band )
+    : offset( band.str.size() ), rows_drawn( band.rows_drawn ), cursor_x( band.cursor_x ),
+      cursor_y( band.cursor_y ), cursor_visible( band.cursor_visible ),
+      known( band.cursor_x >= 0 && band.rendition_known && band.hyperlink_known ),
+      rendition( band.current_rendition ), hyperlink( band.current_hyperlink )
+  {}
+
+  bool matches( const FrameState& frame ) const
+  {
+    return known && cursor_x == frame.cursor_x && cursor_y == frame.cursor_y && cursor_visible == frame.cursor_visible
+           && rendition == frame.current_rendition && !( hyperlink != frame.current_hyperlink );
+  }
+};
+
+/* Paint rows frame_y and below as bands on the worker pool, then join
+   the bands in order.  A band never starts right after a row that wraps
+   into it, so each band's first row starts with a fresh line.
+
+   A band starts out not knowing the cursor position or rendition, so
+   the join paints its first rows again, in order, until the frame
+   stands where the band stood after the same row.  The rest of the
+   band's output is then what painting in order would have produced,
+   and the result is the same byte for byte. */
+void Display::put_rows_in_bands( bool initialized,
+                                 FrameState& frame,
+                                 const Framebuffer& f,
+                                 const Framebuffer::rows_type& rows,
+                                 int frame_y ) const
+{
+  WorkerPool& pool = WorkerPool::get_instance();
+  const int band_count = parallel_bands ? parallel_bands : static_cast<int>( pool.size() );
+  const int height = f.ds.get_height();
+  const int band_height = ( height - frame_y + band_count - 1 ) / band_count;
+
+  std::vector<int> band_start( 1, frame_y );
+  for ( int y = frame_y + band_height; y < height; y += band_height ) {
+    while ( y < height && f.get_row( y - 1 )->get_wrap() ) {
+      y++;
+    }
+    if ( y >= height ) {
+      break;
+    }
+    band_start.push_back( y );
+  }
+  band_start.push_back( height );
+
+  std::deque<FrameState> bands;
+  std::deque<std::vector<BandMark>> marks; /* per row, up to the first row that leaves all state known */
+  std::vector<WorkerPool::job_type> jobs;
+  for ( size_t i = 0; i + 1 < band_start.size(); i++ ) {
+    const int first = band_start[i];
+    const int end = band_start[i + 1];
+    FrameState& band = bands.emplace_back( frame, end - first );
+    std::vector<BandMark>& band_marks = marks.emplace_back();
+    jobs.push_back( [this, initialized, &band, &band_marks, &f, &rows, first, end] {
+      bool wrap = false;
+      for ( int y = first; y < end; y++ ) {
+        wrap = put_row( initialized, band, f, y, *rows.at( y ), wrap );
+        if ( band_marks.empty() || !band_marks.back().known ) {
+          band_marks.push_back( BandMark( band ) );
+        }
+      }
+    } );
+  }
+
+  pool.run( jobs );
+
+  for ( size_t i = 0; i < bands.size(); i++ ) {
+    const FrameState& band = bands[i];
+    const std::vector<BandMark>& band_marks = marks[i];
+    bool wrap = false;
+    size_t row = 0;
+    for ( int y = band_start[i]; y < band_start[i + 1]; y++, row++ ) {
+      wrap = put_row( initialized, frame, f, y, *rows.at( y ), wrap );
+      if ( row < band_marks.size() && band_marks[row].matches( frame ) ) {
+        frame.str.append( band.str, band_marks[row].offset, std::string::npos );
+        frame.rows_drawn += band.rows_drawn - band_marks[row].rows_drawn;
+        frame.cursor_x = band.cursor_x;
+        frame.cursor_y = band.cursor_y;
+        frame.cursor_visible = band.cursor_visible;
+        frame.current_rendition = band.current_rendition;
+        frame.current_hyperlink = band.current_hyperlink;
+        break;
+      }
+    }
+  }
 }
 
 bool Display::put_row( bool initialized,
@@ -350,6 +560,8 @@ bool Display::put_row( bool initialized,
     return false;
   }
 
+  frame.rows_drawn++;
+
   const bool wrap_this = row.get_wrap();
   const int row_width = f.ds.get_width();
   int clear_count = 0;
@@ -474,13 +686,21 @@ bool Display::can_use_erase( const FrameState& frame ) const
 }
 
 FrameState::FrameState( const Framebuffer& s_last )
-  : str(), cursor_x( 0 ), cursor_y( 0 ), current_rendition( 0 ), current_hyperlink(),
-    cursor_visible( s_last.ds.cursor_visible ), last_frame( s_last )
+  : str(), cursor_x( 0 ), cursor_y( 0 ), current_rendition( 0 ), current_hyperlink(), rendition_known( true ),
+    hyperlink_known( true ), cursor_visible( s_last.ds.cursor_visible ), rows_drawn( 0 ), last_frame( s_last )
 {
   /* Preallocate for better performance.  Make a guess-- doesn't matter for correctness */
   str.reserve( last_frame.ds.get_width() * last_frame.ds.get_height() * 4 );
 }
 
+FrameState::FrameState( const FrameState& whole, int band_height )
+  : str(), cursor_x( -1 ), cursor_y( -1 ), current_rendition( 0 ), current_hyperlink(), rendition_known( false ),
+    hyperlink_known( false ), cursor_visible( whole.cursor_visible ), rows_drawn( 0 ),
+    last_frame( whole.last_frame )
+{
+  str.reserve( last_frame.ds.get_width() * band_height * 4 );
+}
+
 void FrameState::append_silent_move( int y, int x )
 {
   if ( cursor_x == x && cursor_y == y )
@@ -523,18 +743,20 @@ void FrameState::append_move( int y, int x )
 
 void FrameState::update_rendition( const Renditions& r, bool force )
 {
-  if ( force || !( current_rendition == r ) ) {
+  if ( force || !rendition_known || !( current_rendition == r ) ) {
     /* print renditions */
     append_string( r.sgr() );
     current_rendition = r;
+    rendition_known = true;
   }
 }
 
 void FrameState::update_hyperlink( const Hyperlink& h, bool force )
 {
-  if ( force || current_hyperlink != h ) {
+  if ( force || !hyperlink_known || current_hyperlink != h ) {
     /* print hyperlink */
     append_string( h.osc8() );
     current_hyperlink = h;
+    hyperlink_known = true;
   }
 }
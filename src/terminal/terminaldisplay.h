@@ -33,6 +33,8 @@
 #ifndef TERMINALDISPLAY_HPP
 #define TERMINALDISPLAY_HPP
 
+#include <cstdio>
+
 #include "src/terminal/terminalframebuffer.h"
 
 namespace Terminal {
@@ -45,12 +47,20 @@ public:
   int cursor_x, cursor_y;
   Renditions current_rendition;
   Hyperlink current_hyperlink;
+  bool rendition_known, hyperlink_known; /* false until first set in a band */
   bool cursor_visible;
 
+  int rows_drawn; /* rows that differed from the last frame */
+
   const Framebuffer& last_frame;
 
   FrameState( const Framebuffer& s_last );
 
+  /* A band of rows painted on its own.  The cursor position,
+     rendition and hyperlink start out unknown, so the first use of
+     each is spelled out and the band can follow any other output. */
+  FrameState( const FrameState& whole, int band_height );
+
   void append( char c ) { str.append( 1, c ); }
   void append( size_t s, char c ) { str.append( s, c ); }
   void append( wchar_t wc ) { Cell::append_to_str( str, wc ); }
@@ -64,6 +74,18 @@ public:
   void update_hyperlink( const Hyperlink& h, bool force = false );
 };
 
+/* Which painting strategy new_frame() picked, over the life of the process */
+class FrameStrategyStats
+{
+public:
+  uint64_t incremental;      /* incremental diff used, repaint not considered */
+  uint64_t repaint;          /* full repaint was smaller and was used */
+  uint64_t repaint_rejected; /* repaint looked cheaper but was not */
+  uint64_t bytes_saved;      /* by choosing the repaint */
+
+  FrameStrategyStats() : incremental( 0 ), repaint( 0 ), repaint_rejected( 0 ), bytes_saved( 0 ) {}
+};
+
 class Display
 {
 private:
@@ -85,6 +107,19 @@ private:
 
   bool can_use_erase( const FrameState& frame ) const;
 
+  bool paint( bool initialized, FrameState& frame, const Framebuffer& f, bool clear_first = false ) const;
+
+  void put_rows_in_bands( bool initialized,
+                          FrameState& frame,
+                          const Framebuffer& f,
+                          const Framebuffer::rows_type& rows,
+                          int frame_y ) const;
+
+  static int parallel_threshold; /* cells to paint before splitting rows into bands */
+  static int parallel_bands;     /* bands to split into; 0 for one per worker */
+
+  static size_t estimate_repaint_size( const Framebuffer& f );
+
 public:
   std::string open() const;
   std::string close() const;
@@ -92,6 +127,13 @@ public:
   std::string new_frame( bool initialized, const Framebuffer& last, const Framebuffer& f ) const;
 
   Display( bool use_environment );
+
+  static const FrameStrategyStats& get_strategy_stats( void );
+  /* one line, for --verbose */
+  static void print_strategy_stats( FILE* out );
+
+  static void set_parallel_threshold( int cells ) { parallel_threshold = cells; }
+  static void set_parallel_bands( int bands ) { parallel_bands = bands; }
 };
 }
 
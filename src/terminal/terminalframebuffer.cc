@@ -55,26 +55,27 @@ void Cell::reset( color_type background_color )
 void DrawState::reinitialize_tabs( unsigned int start )
 {
   assert( default_tabs );
-  for ( unsigned int i = start; i < tabs.size(); i++ ) {
-    tabs[i] = ( ( i % 8 ) == 0 );
+  std::vector<bool>& t = mutable_tabs();
+  for ( unsigned int i = start; i < t.size(); i++ ) {
+    t[i] = ( ( i % 8 ) == 0 );
   }
 }
 
 DrawState::DrawState( int s_width, int s_height )
   : width( s_width ), height( s_height ), cursor_col( 0 ), cursor_row( 0 ), combining_char_col( 0 ),
-    combining_char_row( 0 ), default_tabs( true ), tabs( s_width ), scrolling_region_top_row( 0 ),
-    scrolling_region_bottom_row( height - 1 ), renditions( 0 ), hyperlink(), save(), next_print_will_wrap( false ),
-    origin_mode( false ), auto_wrap_mode( true ), insert_mode( false ), cursor_visible( true ),
-    reverse_video( false ), bracketed_paste( false ), mouse_reporting_mode( MOUSE_REPORTING_NONE ),
-    mouse_focus_event( false ), mouse_alternate_scroll( false ), mouse_encoding_mode( MOUSE_ENCODING_DEFAULT ),
-    application_mode_cursor_keys( false )
+    combining_char_row( 0 ), default_tabs( true ), tabs( std::make_shared<std::vector<bool>>( s_width ) ),
+    scrolling_region_top_row( 0 ), scrolling_region_bottom_row( height - 1 ), renditions( 0 ), hyperlink(), save(),
+    next_print_will_wrap( false ), origin_mode( false ), auto_wrap_mode( true ), insert_mode( false ),
+    cursor_visible( true ), reverse_video( false ), bracketed_paste( false ),
+    mouse_reporting_mode( MOUSE_REPORTING_NONE ), mouse_focus_event( false ), mouse_alternate_scroll( false ),
+    mouse_encoding_mode( MOUSE_ENCODING_DEFAULT ), application_mode_cursor_keys( false )
 {
   reinitialize_tabs( 0 );
 }
 
 Framebuffer::Framebuffer( int s_width, int s_height )
-  : rows(), icon_name(), window_title(), clipboard(), bell_count( 0 ), title_initialized( false ),
-    ds( s_width, s_height )
+  : rows(), icon_name( empty_title() ), window_title( empty_title() ), clipboard( empty_title() ),
+    bell_count( 0 ), title_initialized( false ), ds( s_width, s_height )
 {
   assert( s_height > 0 );
   assert( s_width > 0 );
@@ -83,6 +84,12 @@ Framebuffer::Framebuffer( int s_width, int s_height )
   rows = rows_type( s_height, row_pointer( std::make_shared<Row>( w, c ) ) );
 }
 
+const Framebuffer::title_pointer& Framebuffer::empty_title( void )
+{
+  static const title_pointer empty = std::make_shared<const title_type>();
+  return empty;
+}
+
 Framebuffer::Framebuffer( const Framebuffer& other )
   : rows( other.rows ), icon_name( other.icon_name ), window_title( other.window_title ),
     clipboard( other.clipboard ), bell_count( other.bell_count ), title_initialized( other.title_initialized ),
@@ -201,26 +208,26 @@ Cell* Framebuffer::get_combining_cell( void )
 
 void DrawState::set_tab( void )
 {
-  tabs[cursor_col] = true;
+  mutable_tabs()[cursor_col] = true;
 }
 
 void DrawState::clear_tab( int col )
 {
-  tabs[col] = false;
+  mutable_tabs()[col] = false;
 }
 
 int DrawState::get_next_tab( int count ) const
 {
   if ( count >= 0 ) {
     for ( int i = cursor_col + 1; i < width; i++ ) {
-      if ( tabs[i] && --count == 0 ) {
+      if ( ( *tabs )[i] && --count == 0 ) {
         return i;
       }
     }
     return -1;
   }
   for ( int i = cursor_col - 1; i > 0; i-- ) {
-    if ( tabs[i] && ++count == 0 ) {
+    if ( ( *tabs )[i] && ++count == 0 ) {
       return i;
     }
   }
@@ -386,8 +393,8 @@ void Framebuffer::reset( void )
   int width = ds.get_width(), height = ds.get_height();
   ds = DrawState( width, height );
   rows = rows_type( height, newrow() );
-  window_title.clear();
-  clipboard.clear();
+  window_title = empty_title();
+  clipboard = empty_title();
   /* do not reset bell_count */
 }
 
@@ -436,7 +443,7 @@ void DrawState::resize( int s_width, int s_height )
     scrolling_region_bottom_row = s_height - 1;
   }
 
-  tabs.resize( s_width );
+  mutable_tabs().resize( s_width );
   if ( default_tabs ) {
     reinitialize_tabs( width );
   }
@@ -642,11 +649,58 @@ void Row::reset( color_type background_color )
 
 void Framebuffer::prefix_window_title( const title_type& s )
 {
-  if ( icon_name == window_title ) {
+  title_type prefixed( s );
+  prefixed.insert( prefixed.end(), window_title->begin(), window_title->end() );
+  if ( same_title( icon_name, window_title ) ) {
     /* preserve equivalence */
-    icon_name.insert( icon_name.begin(), s.begin(), s.end() );
+    set_icon_name( prefixed );
+  }
+  set_window_title( prefixed );
+}
+
+/* heap storage for a string, if it is not held inline */
+static size_t string_heap_usage( const std::string& s )
+{
+  const char* data = s.data();
+  const char* self = reinterpret_cast<const char*>( &s );
+  if ( ( data >= self ) && ( data < self + sizeof( s ) ) ) {
+    return 0;
+  }
+  return s.capacity() + 1;
+}
+
+size_t Row::memory_usage( void ) const
+{
+  size_t total = sizeof( Row ) + cells.capacity() * sizeof( Cell );
+  for ( cells_type::const_iterator i = cells.begin(); i != cells.end(); i++ ) {
+    total += string_heap_usage( i->get_contents() );
+  }
+  return total;
+}
+
+size_t DrawState::memory_usage( std::unordered_set<const void*>& seen ) const
+{
+  if ( !seen.insert( tabs.get() ).second ) {
+    return 0;
+  }
+  return sizeof( std::vector<bool> ) + ( tabs->capacity() + CHAR_BIT - 1 ) / CHAR_BIT;
+}
+
+size_t Framebuffer::memory_usage( std::unordered_set<const void*>& seen ) const
+{
+  size_t total = rows.capacity() * sizeof( row_pointer );
+  for ( rows_type::const_iterator i = rows.begin(); i != rows.end(); i++ ) {
+    if ( seen.insert( i->get() ).second ) {
+      total += ( *i )->memory_usage();
+    }
+  }
+  const title_pointer* titles[] = { &icon_name, &window_title, &clipboard };
+  for ( size_t i = 0; i < sizeof( titles ) / sizeof( titles[0] ); i++ ) {
+    if ( seen.insert( titles[i]->get() ).second ) {
+      total += sizeof( title_type ) + ( *titles[i] )->capacity() * sizeof( wchar_t );
+    }
   }
-  window_title.insert( window_title.begin(), s.begin(), s.end() );
+  return total + ds.memory_usage( seen );
 }
 
 std::string Cell::debug_contents( void ) const
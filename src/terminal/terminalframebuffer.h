@@ -40,6 +40,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -71,6 +72,9 @@ private:
 
 public:
   Renditions( color_type s_background );
+  Renditions( color_type s_foreground, color_type s_background, unsigned int s_attributes )
+    : foreground_color( s_foreground ), background_color( s_background ), attributes( s_attributes )
+  {}
   void set_foreground_color( int num );
   void set_background_color( int num );
   void set_rendition( color_type num );
@@ -83,8 +87,9 @@ public:
 
   static bool is_true_color( unsigned int color ) { return ( color & true_color_mask ) != 0; }
 
-  // unsigned int get_foreground_rendition() const { return foreground_color; }
+  unsigned int get_foreground_rendition() const { return foreground_color; }
   unsigned int get_background_rendition() const { return background_color; }
+  unsigned int get_attributes() const { return attributes; }
 
   bool operator==( const Renditions& x ) const
   {
@@ -112,6 +117,9 @@ public:
   bool empty() const { return rep == nullptr; }
   operator bool() const { return !empty(); }
 
+  const std::string& get_params() const { return rep ? rep->params : empty_string(); }
+  const std::string& get_url() const { return rep ? rep->url : empty_string(); }
+
   bool operator==( const Hyperlink& x ) const;
 
   bool operator!=( const Hyperlink& x ) const { return !operator==( x ); }
@@ -123,6 +131,12 @@ private:
     std::string url;
   };
   std::shared_ptr<Rep> rep;
+
+  static const std::string& empty_string()
+  {
+    static const std::string empty;
+    return empty;
+  }
 };
 
 class Cell
@@ -155,6 +169,9 @@ public:
   /* Accessors for contents field */
   std::string debug_contents( void ) const;
 
+  const std::string& get_contents( void ) const { return contents; }
+  void set_contents( const char* s, size_t len ) { contents.assign( s, s + len ); }
+
   bool empty( void ) const { return contents.empty(); }
   /* 32 seems like a reasonable limit on combining characters */
   bool full( void ) const { return contents.size() >= 32; }
@@ -267,6 +284,8 @@ public:
   void set_wrap( bool w ) { cells.back().set_wrap( w ); }
 
   uint64_t get_gen() const;
+
+  size_t memory_usage( void ) const; /* approximate, including the Row itself */
 };
 
 class SavedCursor
@@ -293,8 +312,18 @@ private:
   int cursor_col, cursor_row;
   int combining_char_col, combining_char_row;
 
+  /* Tab stops rarely change, so copies of the DrawState share them
+     and copy on write, like the Framebuffer's rows. */
   bool default_tabs;
-  std::vector<bool> tabs;
+  std::shared_ptr<std::vector<bool>> tabs;
+
+  std::vector<bool>& mutable_tabs( void )
+  {
+    if ( tabs.use_count() > 1 ) {
+      tabs = std::make_shared<std::vector<bool>>( *tabs );
+    }
+    return *tabs;
+  }
 
   void reinitialize_tabs( unsigned int start );
 
@@ -379,6 +408,9 @@ public:
 
   void resize( int s_width, int s_height );
 
+  /* approximate heap footprint, counting storage already in seen as free */
+  size_t memory_usage( std::unordered_set<const void*>& seen ) const;
+
   DrawState( int s_width, int s_height );
 
   bool operator==( const DrawState& x ) const
@@ -407,16 +439,21 @@ class Framebuffer
   // Framebuffers is to simply compare the pointer values.  If they
   // are equal, then the rows are obviously identical.
   // * If no row is shared, the frame has not been modified.
+  //
+  // The titles and clipboard are immutable once set and shared the
+  // same way, so a retained copy of the Framebuffer costs one rows
+  // vector plus whatever rows actually differ.
 public:
   typedef std::vector<wchar_t> title_type;
   typedef std::shared_ptr<Row> row_pointer;
   typedef std::vector<row_pointer> rows_type; /* can be either std::vector or std::deque */
+  typedef std::shared_ptr<const title_type> title_pointer;
 
 private:
   rows_type rows;
-  title_type icon_name;
-  title_type window_title;
-  title_type clipboard;
+  title_pointer icon_name;
+  title_pointer window_title;
+  title_pointer clipboard;
   unsigned int bell_count;
   bool title_initialized; /* true if the window title has been set via an OSC */
 
@@ -427,6 +464,9 @@ private:
     return std::make_shared<Row>( w, c );
   }
 
+  static const title_pointer& empty_title( void );
+  static bool same_title( const title_pointer& a, const title_pointer& b ) { return ( a == b ) || ( *a == *b ); }
+
 public:
   Framebuffer( int s_width, int s_height );
   Framebuffer( const Framebuffer& other );
@@ -495,12 +535,12 @@ public:
 
   void set_title_initialized( void ) { title_initialized = true; }
   bool is_title_initialized( void ) const { return title_initialized; }
-  void set_icon_name( const title_type& s ) { icon_name = s; }
-  void set_window_title( const title_type& s ) { window_title = s; }
-  void set_clipboard( const title_type& s ) { clipboard = s; }
-  const title_type& get_icon_name( void ) const { return icon_name; }
-  const title_type& get_window_title( void ) const { return window_title; }
-  const title_type& get_clipboard( void ) const { return clipboard; }
+  void set_icon_name( const title_type& s ) { icon_name = std::make_shared<const title_type>( s ); }
+  void set_window_title( const title_type& s ) { window_title = std::make_shared<const title_type>( s ); }
+  void set_clipboard( const title_type& s ) { clipboard = std::make_shared<const title_type>( s ); }
+  const title_type& get_icon_name( void ) const { return *icon_name; }
+  const title_type& get_window_title( void ) const { return *window_title; }
+  const title_type& get_clipboard( void ) const { return *clipboard; }
 
   void prefix_window_title( const title_type& s );
 
@@ -511,10 +551,17 @@ public:
 
   void ring_bell( void ) { bell_count++; }
   unsigned int get_bell_count( void ) const { return bell_count; }
+  void set_bell_count( unsigned int n ) { bell_count = n; }
+
+  /* for applying a structured screen update */
+  void set_row( int row, const row_pointer& r ) { rows.at( row ) = r; }
+
+  /* approximate heap footprint, counting storage already in seen as free */
+  size_t memory_usage( std::unordered_set<const void*>& seen ) const;
 
   bool operator==( const Framebuffer& x ) const
   {
-    return ( rows == x.rows ) && ( window_title == x.window_title ) && ( clipboard == x.clipboard )
+    return ( rows == x.rows ) && same_title( window_title, x.window_title ) && same_title( clipboard, x.clipboard )
            && ( bell_count == x.bell_count ) && ( ds == x.ds );
   }
 };
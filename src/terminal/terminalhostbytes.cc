@@ -0,0 +1,245 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include <cstdint>
+
+#include "src/terminal/terminal.h"
+
+using namespace Terminal;
+
+/*
+ * The server only ever sends the client what Display::new_frame()
+ * writes: printable characters, CR/LF/BS/BEL, CSI sequences without
+ * intermediates, and BEL- or ST-terminated OSC strings.  Those are
+ * recognized here directly and handed to the same Emulator and
+ * Dispatcher methods the Parser's actions would call, in the same
+ * order, so the result is identical.  Nothing here allocates an
+ * Action.  Anything else is left for Complete to feed through the
+ * general Parser.
+ */
+
+/* Decode one well-formed UTF-8 character.  Returns its length, or 0 if
+   the bytes are malformed, truncated, overlong or a surrogate. */
+static size_t decode_utf8( const unsigned char* str, size_t len, wchar_t* ch )
+{
+  size_t n;
+  uint32_t c;
+
+  if ( ( 0xC2 <= str[0] ) && ( str[0] <= 0xDF ) ) {
+    n = 2;
+    c = str[0] & 0x1F;
+  } else if ( ( 0xE0 <= str[0] ) && ( str[0] <= 0xEF ) ) {
+    n = 3;
+    c = str[0] & 0x0F;
+  } else if ( ( 0xF0 <= str[0] ) && ( str[0] <= 0xF4 ) ) {
+    n = 4;
+    c = str[0] & 0x07;
+  } else {
+    return 0;
+  }
+
+  if ( len < n ) {
+    return 0;
+  }
+
+  for ( size_t i = 1; i < n; i++ ) {
+    if ( ( str[i] & 0xC0 ) != 0x80 ) {
+      return 0;
+    }
+    c = ( c << 6 ) | ( str[i] & 0x3F );
+  }
+
+  if ( ( n == 3 && c < 0x800 ) || ( n == 4 && ( c < 0x10000 || c > 0x10FFFF ) )
+       || ( ( 0xD800 <= c ) && ( c <= 0xDFFF ) ) ) {
+    return 0;
+  }
+
+  *ch = c;
+  return n;
+}
+
+/* ESC [ [?] [0-9;]* final */
+size_t Emulator::interpret_CSI( const unsigned char* str, size_t len )
+{
+  size_t end = 2;
+  if ( ( end < len ) && ( str[end] == '?' ) ) {
+    end++;
+  }
+  while ( ( end < len ) && ( ( ( '0' <= str[end] ) && ( str[end] <= '9' ) ) || ( str[end] == ';' ) ) ) {
+    end++;
+  }
+  if ( ( end >= len ) || ( str[end] < 0x40 ) || ( str[end] > 0x7E ) ) {
+    return 0;
+  }
+
+  Parser::Clear clear;
+  dispatch.clear( &clear );
+
+  size_t i = 2;
+  if ( str[i] == '?' ) {
+    Parser::Collect collect;
+    collect.char_present = true;
+    collect.ch = '?';
+    dispatch.collect( &collect );
+    i++;
+  }
+
+  Parser::Param param;
+  param.char_present = true;
+  for ( ; i < end; i++ ) {
+    param.ch = str[i];
+    dispatch.newparamchar( &param );
+  }
+
+  Parser::CSI_Dispatch act;
+  act.char_present = true;
+  act.ch = str[end];
+  CSI_dispatch( &act );
+
+  return end + 1;
+}
+
+/* ESC ] string BEL, or ESC ] string ESC \ */
+size_t Emulator::interpret_OSC( const unsigned char* str, size_t len )
+{
+  size_t end = 2;
+  while ( end < len ) {
+    wchar_t ch;
+    if ( ( 0x20 <= str[end] ) && ( str[end] <= 0x7F ) ) {
+      end++;
+    } else if ( ( str[end] >= 0x80 ) && decode_utf8( str + end, len - end, &ch ) && ( ch >= 0xA0 ) ) {
+      end += decode_utf8( str + end, len - end, &ch );
+    } else {
+      break;
+    }
+  }
+
+  size_t terminator;
+  if ( ( end < len ) && ( str[end] == 0x07 ) ) {
+    terminator = 1;
+  } else if ( ( end + 1 < len ) && ( str[end] == 0x1B ) && ( str[end + 1] == '\\' ) ) {
+    terminator = 2;
+  } else {
+    return 0;
+  }
+
+  Parser::Clear clear;
+  dispatch.clear( &clear );
+
+  Parser::OSC_Start start;
+  dispatch.OSC_start( &start );
+
+  Parser::OSC_Put put;
+  put.char_present = true;
+  for ( size_t i = 2; i < end; ) {
+    if ( str[i] < 0x80 ) {
+      put.ch = str[i++];
+    } else {
+      i += decode_utf8( str + i, len - i, &put.ch );
+    }
+    dispatch.OSC_put( &put );
+  }
+
+  Parser::OSC_End osc_end;
+  OSC_end( &osc_end );
+
+  if ( terminator == 2 ) {
+    /* the Parser sees ST as an escape sequence of its own */
+    dispatch.clear( &clear );
+    Parser::Esc_Dispatch act;
+    act.char_present = true;
+    act.ch = '\\';
+    Esc_dispatch( &act );
+  }
+
+  return end + terminator;
+}
+
+size_t Emulator::interpret_hostbytes( const char* s, size_t len )
+{
+  const unsigned char* str = reinterpret_cast<const unsigned char*>( s );
+  size_t i = 0;
+
+  while ( i < len ) {
+    size_t used = 0;
+
+    if ( ( 0x20 <= str[i] ) && ( str[i] < 0x7F ) ) {
+      Parser::Print act;
+      act.char_present = true;
+      act.ch = str[i];
+      print( &act );
+      used = 1;
+    } else if ( str[i] >= 0x80 ) {
+      Parser::Print act;
+      act.char_present = true;
+      used = decode_utf8( str + i, len - i, &act.ch );
+      if ( used && ( act.ch < 0xA0 ) ) { /* C1 control */
+        used = 0;
+      }
+      if ( used ) {
+        print( &act );
+      }
+    } else {
+      switch ( str[i] ) {
+        case 0x07: /* BEL */
+        case 0x08: /* BS */
+        case 0x0A: /* LF */
+        case 0x0D: /* CR */
+        {
+          Parser::Execute act;
+          act.char_present = true;
+          act.ch = str[i];
+          execute( &act );
+          used = 1;
+        } break;
+        case 0x1B:
+          if ( i + 1 < len ) {
+            if ( str[i + 1] == '[' ) {
+              used = interpret_CSI( str + i, len - i );
+            } else if ( str[i + 1] == ']' ) {
+              used = interpret_OSC( str + i, len - i );
+            }
+          }
+          break;
+        default:
+          break;
+      }
+    }
+
+    if ( !used ) {
+      break;
+    }
+    i += used;
+  }
+
+  return i;
+}
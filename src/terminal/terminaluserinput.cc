@@ -31,6 +31,7 @@
 */
 
 #include <cassert>
+#include <cstring>
 
 #include "terminaluserinput.h"
 
@@ -79,3 +80,25 @@ std::string UserInput::input( const Parser::UserByte* act, bool application_mode
       return std::string();
   }
 }
+
+void UserInput::input( const char* str, size_t len, bool application_mode_cursor_keys, std::string& out )
+{
+  const char* const end = str + len;
+  while ( str < end ) {
+    if ( state == Ground ) {
+      /* everything up to the next ESC passes through unchanged */
+      const char* esc = static_cast<const char*>( memchr( str, 0x1b, end - str ) );
+      if ( esc == NULL ) {
+        out.append( str, end - str );
+        return;
+      }
+      out.append( str, esc + 1 - str );
+      str = esc + 1;
+      state = ESC;
+      continue;
+    }
+
+    Parser::UserByte act( *str++ );
+    out.append( input( &act, application_mode_cursor_keys ) );
+  }
+}
@@ -55,6 +55,9 @@ public:
 
   std::string input( const Parser::UserByte* act, bool application_mode_cursor_keys );
 
+  /* Translate a run of keystrokes at once, appending the result to out */
+  void input( const char* str, size_t len, bool application_mode_cursor_keys, std::string& out );
+
   bool operator==( const UserInput& x ) const { return state == x.state; }
 };
 }
@@ -0,0 +1,131 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests codec selection: zlib is always there and is the fallback,
+   unknown codecs are refused, and the optional zstd and lz4 codecs, when
+   built in, round-trip and are used only once the peer advertises them. */
+
+#include "src/include/config.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "src/network/compressor.h"
+#include "src/network/network.h"
+#include "test_common.h"
+
+using namespace Network;
+
+/* terminal-like output, with some noise so not everything compresses */
+static std::string make_payload( size_t len )
+{
+  static const char* const pieces[] = { "\033[0m", "\033[K", "\r\n", "\033[1;32m", "hello ", "world " };
+  std::string out;
+  while ( out.size() < len ) {
+    if ( prng() % 8 == 0 ) {
+      out.push_back( char( prng() ) );
+    } else {
+      out += pieces[prng() % ( sizeof( pieces ) / sizeof( pieces[0] ) )];
+    }
+  }
+  out.resize( len );
+  return out;
+}
+
+/* zlib streams have deflate (8) in the low nibble of their first byte */
+static bool is_zlib( const std::string& compressed )
+{
+  return ( compressed[0] & 0x0f ) == 8;
+}
+
+static void test_fallback( void )
+{
+  Compressor& compressor = get_compressor();
+  check( !strcmp( compressor.get_preference(), "zlib" ), "zlib is preferred by default" );
+  check( !compressor.set_preference( "brotli" ), "unknown codec is refused" );
+  check( !compressor.set_preference( "" ), "empty codec name is refused" );
+  check( !strcmp( compressor.get_preference(), "zlib" ), "a refused codec leaves the preference alone" );
+#ifndef HAVE_ZSTD
+  check( !compressor.set_preference( "zstd" ), "zstd is refused unless built in" );
+  check( !( compressor.capabilities() & CAPABILITY_ZSTD ), "zstd is advertised only if built in" );
+#endif
+#ifndef HAVE_LZ4
+  check( !compressor.set_preference( "lz4" ), "lz4 is refused unless built in" );
+  check( !( compressor.capabilities() & CAPABILITY_LZ4 ), "lz4 is advertised only if built in" );
+#endif
+  check( compressor.set_preference( "zlib" ), "zlib is always built in" );
+
+  /* with zlib preferred, a peer's other codecs go unused */
+  for ( size_t len = STORED_THRESHOLD; len < 300000; len = len * 3 + 1 ) {
+    const std::string payload = make_payload( len );
+    const std::string compressed = compressor.compress_str( payload, CAPABILITY_ZSTD | CAPABILITY_LZ4 );
+    check( is_zlib( compressed ), "zlib used when preferred" );
+    check( compressor.uncompress_str( compressed ) == payload, "zlib round-trips" );
+  }
+}
+
+#if defined HAVE_ZSTD || defined HAVE_LZ4
+static void test_codec( const char* name, uint32_t capability )
+{
+  Compressor& compressor = get_compressor();
+  check( compressor.set_preference( name ), "codec is built in" );
+  check( compressor.capabilities() & capability, "codec is advertised" );
+
+  for ( size_t len = STORED_THRESHOLD; len < 300000; len = len * 3 + 1 ) {
+    const std::string payload = make_payload( len );
+
+    const std::string compressed = compressor.compress_str( payload, capability );
+    check( !is_zlib( compressed ), "codec used once the peer advertises it" );
+    check( compressor.uncompress_str( compressed ) == payload, "codec round-trips" );
+
+    const std::string fallback = compressor.compress_str( payload, 0 );
+    check( is_zlib( fallback ), "zlib used unless the peer advertises the codec" );
+    check( compressor.uncompress_str( fallback ) == payload, "zlib round-trips" );
+  }
+
+  check( compressor.set_preference( "zlib" ), "zlib is always built in" );
+}
+#endif
+
+int main()
+{
+  test_fallback();
+#ifdef HAVE_ZSTD
+  test_codec( "zstd", CAPABILITY_ZSTD );
+#endif
+#ifdef HAVE_LZ4
+  test_codec( "lz4", CAPABILITY_LZ4 );
+#endif
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,217 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests the zlib wire format with and without
+   CAPABILITY_DEFLATE_DICTIONARY: dictionary streams name the preset
+   dictionary by its Adler-32 and need it to inflate, small payloads
+   use it only when that is shorter, and peers without the capability
+   get, and send, plain zlib streams. */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <zlib.h>
+
+#include "src/crypto/crypto.h"
+#include "src/network/compressor.h"
+#include "src/network/network.h"
+#include "test_common.h"
+
+using namespace Network;
+
+/* Payloads at or above this are compressed with the dictionary without
+   trying both ways (SMALL_INPUT in compressor.cc) */
+static const size_t SMALL_INPUT = 4096;
+
+/* RFC 1950: FDICT in the FLG byte, then DICTID, big-endian */
+static bool has_dictionary( const std::string& stream )
+{
+  check( ( stream.size() > 2 ) && ( ( stream[0] & 0x0f ) == 8 ), "a zlib stream" );
+  return stream[1] & 0x20;
+}
+
+static uLong dictionary_id( const std::string& stream )
+{
+  check( stream.size() > 6, "room for DICTID" );
+  const unsigned char* p = reinterpret_cast<const unsigned char*>( stream.data() );
+  return ( uLong( p[2] ) << 24 ) | ( uLong( p[3] ) << 16 ) | ( uLong( p[4] ) << 8 ) | uLong( p[5] );
+}
+
+/* what a peer that knows only zlib does with a payload */
+static int inflate_plain( const std::string& stream, std::string& out, uLong* adler )
+{
+  z_stream inflater = z_stream();
+  check( inflateInit( &inflater ) == Z_OK, "inflateInit" );
+  out.resize( 4 * 1024 * 1024 );
+  inflater.next_in = reinterpret_cast<Bytef*>( const_cast<char*>( stream.data() ) );
+  inflater.avail_in = stream.size();
+  inflater.next_out = reinterpret_cast<Bytef*>( &out[0] );
+  inflater.avail_out = out.size();
+  const int ret = inflate( &inflater, Z_FINISH );
+  out.resize( out.size() - inflater.avail_out );
+  *adler = inflater.adler;
+  inflateEnd( &inflater );
+  return ret;
+}
+
+static std::string random_bytes( size_t len )
+{
+  std::string out;
+  while ( out.size() < len ) {
+    out.push_back( char( prng() ) );
+  }
+  return out;
+}
+
+/* the dictionary is named by one Adler-32, and a peer without it
+   stops at Z_NEED_DICT */
+static void test_dictionary_stream( void )
+{
+  Compressor& compressor = get_compressor();
+  const std::string payloads[] = { "\033[0m\033]8;;\033\\\033[?25l\033[K\r\n$ ",
+                                   random_output( 200 ),
+                                   random_output( SMALL_INPUT - 1 ),
+                                   random_output( SMALL_INPUT ),
+                                   random_output( 100000 ),
+                                   random_bytes( 20000 ) };
+  uLong id = 0;
+  for ( size_t i = 0; i < sizeof( payloads ) / sizeof( payloads[0] ); i++ ) {
+    const std::string with = compressor.compress_str( payloads[i], CAPABILITY_DEFLATE_DICTIONARY );
+    check( compressor.uncompress_str( with ) == payloads[i], "dictionary stream round-trips" );
+    if ( payloads[i].size() >= SMALL_INPUT ) {
+      check( has_dictionary( with ), "large payloads always use the dictionary" );
+    }
+    if ( !has_dictionary( with ) ) {
+      continue;
+    }
+
+    if ( id == 0 ) {
+      id = dictionary_id( with );
+    }
+    check( dictionary_id( with ) == id, "every stream names the same dictionary" );
+
+    std::string out;
+    uLong adler;
+    check( inflate_plain( with, out, &adler ) == Z_NEED_DICT, "inflating needs the dictionary" );
+    check( adler == id, "inflate reports the DICTID" );
+  }
+  check( id != 0, "the dictionary was used" );
+}
+
+/* a stream naming any other dictionary is refused */
+static void test_wrong_dictionary( void )
+{
+  Compressor& compressor = get_compressor();
+  const std::string payload = random_output( SMALL_INPUT );
+  const std::string good = compressor.compress_str( payload, CAPABILITY_DEFLATE_DICTIONARY );
+  check( has_dictionary( good ), "dictionary used for a large payload" );
+
+  for ( int byte = 2; byte < 6; byte++ ) {
+    std::string bad( good );
+    bad[byte] ^= 0x01;
+    bool refused = false;
+    try {
+      compressor.uncompress_str( bad );
+    } catch ( const Crypto::CryptoException& ) {
+      refused = true;
+    }
+    check( refused, "an unknown DICTID is refused" );
+  }
+  check( compressor.uncompress_str( good ) == payload, "the Compressor is usable after a refusal" );
+}
+
+/* below SMALL_INPUT both ways are tried and the shorter is sent */
+static void test_keep_shorter( void )
+{
+  Compressor& compressor = get_compressor();
+
+  /* escape sequences in the dictionary: it wins */
+  const std::string typical = "\033[0m\033]8;;\033\\\033[?25l\033[0m\033[?25h\033[K\r\n";
+  const std::string with = compressor.compress_str( typical, CAPABILITY_DEFLATE_DICTIONARY );
+  const std::string without = compressor.compress_str( typical, 0 );
+  check( has_dictionary( with ), "dictionary used when it helps" );
+  check( with.size() < without.size(), "dictionary stream is shorter" );
+
+  /* random bytes share nothing with it: the four bytes of DICTID
+     would be wasted, so the plain stream is sent */
+  for ( size_t len = 16; len < SMALL_INPUT; len *= 2 ) {
+    const std::string noise = random_bytes( len );
+    const std::string chosen = compressor.compress_str( noise, CAPABILITY_DEFLATE_DICTIONARY );
+    check( !has_dictionary( chosen ), "dictionary not used when it loses" );
+    check( chosen == compressor.compress_str( noise, 0 ), "the plain stream is sent when shorter" );
+    check( compressor.uncompress_str( chosen ) == noise, "plain stream round-trips" );
+  }
+
+  /* every size around the boundary decodes, whichever way was chosen */
+  for ( size_t len = SMALL_INPUT - 8; len < SMALL_INPUT + 8; len++ ) {
+    const std::string payload = random_output( len ).substr( 0, len );
+    const std::string stream = compressor.compress_str( payload, CAPABILITY_DEFLATE_DICTIONARY );
+    check( compressor.uncompress_str( stream ) == payload, "round-trips around SMALL_INPUT" );
+  }
+}
+
+/* a peer without the capability reads our output and we read its */
+static void test_old_peer( void )
+{
+  Compressor& compressor = get_compressor();
+  for ( size_t len = 1; len < 300000; len = len * 3 + 1 ) {
+    const std::string payload = random_output( len );
+
+    const std::string ours = compressor.compress_str( payload, 0 );
+    check( !has_dictionary( ours ), "no dictionary for a peer without the capability" );
+    std::string out;
+    uLong adler;
+    check( inflate_plain( ours, out, &adler ) == Z_STREAM_END, "plain zlib inflates our stream" );
+    check( out == payload, "plain zlib reads our payload" );
+
+    uLongf theirs_len = compressBound( payload.size() );
+    std::string theirs( theirs_len, '\0' );
+    check( compress( reinterpret_cast<Bytef*>( &theirs[0] ),
+                     &theirs_len,
+                     reinterpret_cast<const Bytef*>( payload.data() ),
+                     payload.size() )
+             == Z_OK,
+           "compress" );
+    theirs.resize( theirs_len );
+    check( compressor.uncompress_str( theirs ) == payload, "we read a plain zlib peer" );
+  }
+}
+
+int main()
+{
+  test_dictionary_stream();
+  test_wrong_dictionary();
+  test_keep_shorter();
+  test_old_peer();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,220 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests DelayController's window and pacing rate against fixed
+   sequences of delay, ack, loss and ECN samples */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "src/network/delaycontroller.h"
+#include "test_common.h"
+
+using namespace Network;
+
+static const double BASE_RTT = 50; /* ms */
+
+static bool near( double a, double b )
+{
+  return std::fabs( a - b ) < 1e-6 * std::max( 1.0, std::fabs( b ) );
+}
+
+/* one window of acks, a datagram at a time, with plenty in flight */
+static void ack_window( DelayController& controller )
+{
+  const double window = controller.get_window();
+  for ( double acked = 0; acked < window; acked += DELAY_DATAGRAM ) {
+    controller.ack( DELAY_DATAGRAM, DELAY_MAX_WINDOW );
+  }
+}
+
+static void test_unmeasured( void )
+{
+  DelayController controller;
+  check( !controller.measured(), "no samples yet" );
+  check( controller.queueing_delay() == 0, "no queueing delay before samples" );
+  controller.ack( 100 * DELAY_DATAGRAM, DELAY_MAX_WINDOW );
+  check( controller.get_window() == DELAY_INITIAL_WINDOW, "acks before an RTT sample leave the window" );
+}
+
+static void test_growth( void )
+{
+  DelayController controller;
+  controller.rtt_sample( BASE_RTT, 0 );
+  check( controller.measured(), "measured after one sample" );
+  check( controller.queueing_delay() == 0, "first sample is the base" );
+
+  /* no queueing delay: about one datagram per window of acks */
+  for ( int i = 0; i < 10; i++ ) {
+    const double before = controller.get_window();
+    ack_window( controller );
+    const double growth = controller.get_window() - before;
+    check( growth > 0.9 * DELAY_DATAGRAM && growth < 1.2 * DELAY_DATAGRAM, "grows a datagram per window" );
+  }
+
+  /* an idle session's window stays near what it uses */
+  const double before = controller.get_window();
+  controller.ack( DELAY_DATAGRAM, DELAY_DATAGRAM );
+  check( controller.get_window() == std::min( before, double( DELAY_INITIAL_WINDOW ) ),
+         "window capped by bytes in flight" );
+}
+
+static void test_on_target( void )
+{
+  DelayController controller;
+  controller.rtt_sample( BASE_RTT, 0 );
+  for ( size_t i = 0; i < CURRENT_DELAY_FILTER; i++ ) {
+    controller.rtt_sample( BASE_RTT + DELAY_TARGET, i + 1 );
+  }
+  check( near( controller.queueing_delay(), DELAY_TARGET ), "queueing delay is current less base" );
+  ack_window( controller );
+  check( near( controller.get_window(), DELAY_INITIAL_WINDOW ), "window holds at the target delay" );
+}
+
+static void test_shrink( void )
+{
+  DelayController controller;
+  controller.rtt_sample( BASE_RTT, 0 );
+  for ( size_t i = 0; i < CURRENT_DELAY_FILTER; i++ ) {
+    controller.rtt_sample( BASE_RTT + 10 * DELAY_TARGET, i + 1 );
+  }
+
+  /* far over target: at most a datagram less per window */
+  const double before = controller.get_window();
+  ack_window( controller );
+  const double shrink = before - controller.get_window();
+  check( shrink > 0.9 * DELAY_DATAGRAM && shrink < 1.2 * DELAY_DATAGRAM, "shrinks a datagram per window" );
+
+  for ( int i = 0; i < 100; i++ ) {
+    ack_window( controller );
+  }
+  check( controller.get_window() == DELAY_MIN_WINDOW, "window stops at the minimum" );
+}
+
+static void test_delay_filters( void )
+{
+  DelayController controller;
+  controller.rtt_sample( BASE_RTT, 0 );
+
+  /* a single spike among the last few samples is jitter */
+  controller.rtt_sample( BASE_RTT + 100, 1 );
+  check( controller.queueing_delay() == 0, "current delay is the minimum of recent samples" );
+  for ( size_t i = 0; i < CURRENT_DELAY_FILTER; i++ ) {
+    controller.rtt_sample( BASE_RTT + 100, 2 + i );
+  }
+  check( near( controller.queueing_delay(), 100 ), "sustained delay counts" );
+
+  /* the base is forgotten once its interval leaves the history */
+  uint64_t now = 0;
+  for ( size_t i = 0; i < BASE_DELAY_HISTORY; i++ ) {
+    now += BASE_DELAY_INTERVAL;
+    controller.rtt_sample( BASE_RTT + 100, now );
+  }
+  check( near( controller.base_delay(), BASE_RTT + 100 ), "old base delays expire" );
+  check( near( controller.queueing_delay(), 0 ), "and the new base has no queueing delay" );
+}
+
+static void test_loss( void )
+{
+  const double SRTT = 100;
+  DelayController controller;
+  controller.loss( 1000, SRTT );
+  check( near( controller.get_window(), DELAY_INITIAL_WINDOW / 2 ), "loss halves the window" );
+  controller.loss( 1050, SRTT );
+  check( near( controller.get_window(), DELAY_INITIAL_WINDOW / 2 ), "at most once per RTT" );
+  controller.loss( 1100, SRTT );
+  check( near( controller.get_window(), DELAY_INITIAL_WINDOW / 4 ), "and again after an RTT" );
+  controller.loss( 1200, SRTT );
+  controller.loss( 1300, SRTT );
+  check( controller.get_window() == DELAY_MIN_WINDOW, "never below the minimum" );
+}
+
+static void test_ecn( void )
+{
+  const double SRTT = 100;
+  DelayController controller;
+
+  /* nothing marked: alpha and window stay put */
+  controller.ecn_counts( 100, 0, 100, SRTT );
+  check( controller.get_ecn_alpha() == 0, "unmarked traffic leaves alpha at zero" );
+  check( controller.get_window() == DELAY_INITIAL_WINDOW, "unmarked traffic leaves the window" );
+
+  /* half of the next RTT's datagrams marked */
+  controller.ecn_counts( 150, 50, 200, SRTT );
+  const double alpha = ECN_GAIN * 0.5;
+  check( near( controller.get_ecn_alpha(), alpha ), "alpha moves toward the marked fraction" );
+  check( near( controller.get_window(), DELAY_INITIAL_WINDOW * ( 1 - alpha / 2 ) ), "window shrinks by alpha/2" );
+
+  const double window = controller.get_window();
+
+  /* within the same RTT nothing changes */
+  controller.ecn_counts( 200, 100, 250, SRTT );
+  check( near( controller.get_ecn_alpha(), alpha ), "once per RTT" );
+
+  /* nor for a report overtaken by a later one, even once the RTT is up */
+  controller.ecn_counts( 180, 80, 310, SRTT );
+  check( near( controller.get_ecn_alpha(), alpha ), "reordered counts ignored" );
+  check( near( controller.get_window(), window ), "window unchanged" );
+
+  /* the peer restarted its counts: measure from the new ones */
+  controller.ecn_counts( 10, 0, 320, SRTT );
+  check( near( controller.get_ecn_alpha(), alpha ), "a restart is not a sample" );
+  controller.ecn_counts( 110, 0, 420, SRTT );
+  check( near( controller.get_ecn_alpha(), alpha * ( 1 - ECN_GAIN ) ), "counts after a restart are used" );
+  check( near( controller.get_window(), window ), "unmarked traffic after a restart leaves the window" );
+}
+
+static void test_pacing( void )
+{
+  DelayController controller;
+  check( near( controller.pacing_rate( 100 ), PACING_GAIN * DELAY_INITIAL_WINDOW / 100 ),
+         "a window goes out in a fraction of an RTT" );
+  check( near( controller.pacing_rate( 0 ), PACING_GAIN * DELAY_INITIAL_WINDOW ), "tiny RTTs count as 1 ms" );
+  controller.loss( 1000, 100 );
+  check( near( controller.pacing_rate( 100 ), PACING_GAIN * DELAY_INITIAL_WINDOW / 2 / 100 ),
+         "pacing follows the window" );
+}
+
+int main()
+{
+  test_unmeasured();
+  test_growth();
+  test_on_target();
+  test_shrink();
+  test_delay_filters();
+  test_loss();
+  test_ecn();
+  test_pacing();
+  return EXIT_SUCCESS;
+}
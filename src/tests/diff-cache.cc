@@ -0,0 +1,95 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that a client's TransportSender reuses the diffs it cached
+   when it resends keystrokes, even though every tick subtracts the
+   acknowledged prefix from its UserStreams */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include <unistd.h>
+
+#include "src/network/network.h"
+#include "src/network/transportsender-impl.h"
+#include "src/statesync/user.h"
+#include "src/util/fatal_assert.h"
+#include "src/util/timestamp.h"
+#include "test_common.h"
+
+using namespace Network;
+
+static void type( TransportSender<UserStream>& sender, const std::string& keys )
+{
+  for ( std::string::const_iterator i = keys.begin(); i != keys.end(); i++ ) {
+    sender.get_current_state().push_back( Parser::UserByte( *i ) );
+  }
+}
+
+/* Ticks for up to limit ms, or until the cache has had more hits than before */
+static bool run_until_hit( TransportSender<UserStream>& sender, uint64_t limit )
+{
+  const uint64_t hits = sender.get_diff_cache_hits();
+  freeze_timestamp();
+  const uint64_t start = timestamp();
+  while ( timestamp() - start < limit ) {
+    sender.tick();
+    if ( sender.get_diff_cache_hits() > hits ) {
+      return true;
+    }
+    usleep( 1000 * std::min( std::max( sender.wait_time(), 1 ), 50 ) );
+    freeze_timestamp();
+  }
+  return false;
+}
+
+int main()
+{
+  /* a server that never answers, so keystrokes go out again */
+  Connection server( "127.0.0.1", NULL );
+  Connection client( server.get_key().c_str(), "127.0.0.1", server.port().c_str() );
+  UserStream initial;
+  TransportSender<UserStream> sender( &client, initial );
+
+  type( sender, "echo hello" );
+  check( run_until_hit( sender, 5000 ), "resent keystrokes reuse the cached diff" );
+
+  /* once acknowledged, the prefix is subtracted from every state */
+  sender.process_acknowledgment_through( sender.get_sent_state_last() );
+  fatal_assert( sender.get_sent_state_acked() > 0 );
+  type( sender, " world\r" );
+  check( run_until_hit( sender, 5000 ), "and the cache survives the subtraction" );
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,102 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that estimate_diff_size() stays within a bound of the size of
+   the diff it predicts, for the screen (both encodings) and for
+   keystrokes */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "src/statesync/completeterminal.h"
+#include "src/statesync/user.h"
+#include "src/terminal/parseraction.h"
+#include "test_common.h"
+
+/* Estimates are for ranking candidates, so a factor of two is close
+   enough; small diffs are dominated by fixed overheads. */
+static const size_t FACTOR = 2;
+static const size_t SLACK = 64;
+
+static void check_estimate( size_t estimate, size_t actual, const char* what )
+{
+  if ( estimate + SLACK < actual / FACTOR || estimate > FACTOR * actual + SLACK ) {
+    fprintf( stderr, "estimated %lu bytes, diff is %lu\n", (unsigned long)estimate, (unsigned long)actual );
+    check( false, what );
+  }
+}
+
+static void test_screen( bool cell_diff )
+{
+  Terminal::Complete complete( 80, 24 );
+  complete.set_cell_diff( cell_diff );
+
+  for ( int i = 0; i < 2000; i++ ) {
+    const Terminal::Complete last( complete );
+    /* keystroke echoes, screenfuls, and now and then a resize */
+    if ( i % 50 == 49 ) {
+      complete.act( Parser::Resize( prng() % 100 + 20, prng() % 40 + 10 ) );
+    }
+    complete.act( random_output( ( i % 3 ) ? prng() % 3000 : prng() % 10 + 1 ) );
+
+    check_estimate( complete.estimate_diff_size( last ),
+                    complete.diff_from( last ).size(),
+                    cell_diff ? "cell diff estimate" : "host bytes estimate" );
+  }
+}
+
+static void test_keystrokes( void )
+{
+  Network::UserStream stream;
+  for ( int i = 0; i < 2000; i++ ) {
+    const Network::UserStream last( stream );
+    const int events = ( i % 10 ) ? prng() % 4 + 1 : prng() % 5000;
+    for ( int j = 0; j < events; j++ ) {
+      if ( prng() % 200 == 0 ) {
+        stream.push_back( Parser::Resize( prng() % 200, prng() % 100 ) );
+      } else {
+        stream.push_back( Parser::UserByte( 'a' + prng() % 26 ) );
+      }
+    }
+
+    check_estimate( stream.estimate_diff_size( last ), stream.diff_from( last ).size(), "keystroke estimate" );
+  }
+}
+
+int main()
+{
+  test_screen( false );
+  test_screen( true );
+  test_keystrokes();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that painting a frame in bands gives the same bytes as
+   painting it row by row */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "src/statesync/completeterminal.h"
+#include "src/terminal/terminaldisplay.h"
+#include "test_common.h"
+
+static void test_frames( int width, int height, int bands )
+{
+  Terminal::Complete complete( width, height );
+  const Terminal::Display display( false );
+
+  for ( int i = 0; i < 50; i++ ) {
+    const Terminal::Framebuffer last( complete.get_fb() );
+    complete.act( random_output( prng() % ( width * height ) ) );
+    const Terminal::Framebuffer& f = complete.get_fb();
+
+    for ( int initialized = 0; initialized < 2; initialized++ ) {
+      Terminal::Display::set_parallel_threshold( 1 << 30 );
+      const std::string serial = display.new_frame( initialized, last, f );
+      Terminal::Display::set_parallel_threshold( 1 );
+      Terminal::Display::set_parallel_bands( bands );
+      const std::string banded = display.new_frame( initialized, last, f );
+      Terminal::Display::set_parallel_bands( 0 );
+      check( serial == banded, "banded output is the same as serial output" );
+    }
+  }
+}
+
+int main()
+{
+  for ( int bands = 2; bands <= 7; bands++ ) {
+    test_frames( 80, 24, bands );
+    test_frames( 37, 61, bands );
+    test_frames( 200, 5, bands );
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,194 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that parity fragments rebuild lost fragments of an instruction
+   sent over an in-process lossy link */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "src/network/network.h"
+#include "src/network/transportfragment.h"
+#include "test_common.h"
+
+using namespace Network;
+
+static const size_t MTU = 500;
+
+static Instruction make_instruction( uint64_t num, size_t diff_len )
+{
+  /* random, so it doesn't compress */
+  std::string diff( diff_len, 0 );
+  for ( size_t i = 0; i < diff_len; i++ ) {
+    diff[i] = prng();
+  }
+
+  Instruction inst;
+  inst.set_protocol_version( MOSH_PROTOCOL_VERSION );
+  inst.set_old_num( num );
+  inst.set_new_num( num + 1 );
+  inst.set_ack_num( num );
+  inst.set_throwaway_num( num );
+  inst.set_diff( diff );
+  return inst;
+}
+
+/* Sends the fragments that survive, in random order; true if the
+   receiver got the whole instruction back */
+static bool deliver( FragmentAssembly& assembly,
+                     const Instruction& inst,
+                     const std::vector<FragmentView>& fragments,
+                     const std::vector<bool>& lost )
+{
+  std::vector<std::string> packets;
+  for ( size_t i = 0; i < fragments.size(); i++ ) {
+    if ( !lost[i] ) {
+      char header[Fragment::frag_header_len];
+      fragments[i].write_header( header );
+      packets.push_back( std::string( header, sizeof( header ) )
+                         + std::string( fragments[i].data, fragments[i].len ) );
+    }
+  }
+  std::shuffle( packets.begin(), packets.end(), prng );
+
+  for ( size_t i = 0; i < packets.size(); i++ ) {
+    FragmentView frag( packets[i].data(), packets[i].size() );
+    if ( assembly.add_fragment( frag ) ) {
+      check( assembly.get_assembly().SerializeAsString() == inst.SerializeAsString(), "contents match" );
+      return true;
+    }
+  }
+  return false;
+}
+
+static void test_one_loss_per_group( void )
+{
+  uint64_t num = 0;
+  for ( size_t group = 1; group <= 16; group++ ) {
+    for ( size_t diff_len = 600; diff_len < 12000; diff_len += 1700 ) {
+      Fragmenter fragmenter;
+      FragmentAssembly assembly;
+      fragmenter.set_remote_capabilities( CAPABILITY_PARITY );
+      fragmenter.set_parity_group( group );
+
+      /* lose each position in every group, in turn */
+      for ( size_t position = 0; position < group; position++ ) {
+        const Instruction inst = make_instruction( num++, diff_len );
+        const std::vector<FragmentView> fragments = fragmenter.make_fragments( inst, MTU );
+
+        std::vector<bool> lost( fragments.size(), false );
+        size_t data_in_group = 0;
+        for ( size_t i = 0; i < fragments.size(); i++ ) {
+          check( fragments[i].len <= MTU - Fragment::frag_header_len, "fragments fit the MTU" );
+          if ( fragments[i].parity ) {
+            data_in_group = 0;
+          } else if ( data_in_group++ == position ) {
+            lost[i] = true;
+          }
+        }
+        check( deliver( assembly, inst, fragments, lost ), "one loss per group is rebuilt" );
+      }
+    }
+  }
+}
+
+static void test_two_losses_in_group( void )
+{
+  Fragmenter fragmenter;
+  FragmentAssembly assembly;
+  fragmenter.set_remote_capabilities( CAPABILITY_PARITY );
+  fragmenter.set_parity_group( 4 );
+
+  const Instruction inst = make_instruction( 0, 4000 );
+  const std::vector<FragmentView> fragments = fragmenter.make_fragments( inst, MTU );
+  std::vector<bool> lost( fragments.size(), false );
+  lost[0] = lost[1] = true;
+  check( !deliver( assembly, inst, fragments, lost ), "two losses in one group are not rebuilt" );
+}
+
+static void test_without_capability( void )
+{
+  Fragmenter fragmenter;
+  fragmenter.set_parity_group( 4 );
+
+  const Instruction inst = make_instruction( 0, 4000 );
+  const std::vector<FragmentView> fragments = fragmenter.make_fragments( inst, MTU );
+  for ( size_t i = 0; i < fragments.size(); i++ ) {
+    check( !fragments[i].parity, "no parity unless the peer advertises it" );
+  }
+}
+
+/* independent losses: parity must deliver at least as many instructions */
+static void test_lossy_link( void )
+{
+  const double loss = 0.1;
+  const int trials = 2000;
+  int delivered[2] = { 0, 0 };
+
+  for ( int with_parity = 0; with_parity < 2; with_parity++ ) {
+    Fragmenter fragmenter;
+    FragmentAssembly assembly;
+    fragmenter.set_remote_capabilities( CAPABILITY_PARITY );
+    fragmenter.set_parity_group( with_parity ? 2 : 0 );
+    std::bernoulli_distribution drop( loss );
+
+    for ( int i = 0; i < trials; i++ ) {
+      const Instruction inst = make_instruction( i, 3000 );
+      const std::vector<FragmentView> fragments = fragmenter.make_fragments( inst, MTU );
+      std::vector<bool> lost( fragments.size() );
+      for ( size_t j = 0; j < lost.size(); j++ ) {
+        lost[j] = drop( prng );
+      }
+      delivered[with_parity] += deliver( assembly, inst, fragments, lost );
+    }
+  }
+
+  printf( "%.0f%% loss: %d of %d instructions delivered without parity, %d with\n",
+          100 * loss,
+          delivered[0],
+          trials,
+          delivered[1] );
+  check( delivered[1] > delivered[0] + trials / 5, "parity improves delivery" );
+}
+
+int main()
+{
+  test_one_loss_per_group();
+  test_two_losses_in_group();
+  test_without_capability();
+  test_lossy_link();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that a FrameUpdate encoded from two framebuffers turns the
+   first into the second */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "src/statesync/completeterminal.h"
+#include "src/statesync/framediff.h"
+#include "src/terminal/parseraction.h"
+#include "test_common.h"
+
+using namespace Terminal;
+
+/* Row::operator== compares generations too, which an update does not carry */
+static bool same_screen( const Framebuffer& a, const Framebuffer& b )
+{
+  if ( !( a.ds == b.ds ) || a.get_icon_name() != b.get_icon_name()
+       || a.get_window_title() != b.get_window_title() || a.get_clipboard() != b.get_clipboard()
+       || a.get_bell_count() != b.get_bell_count() || a.is_title_initialized() != b.is_title_initialized() ) {
+    return false;
+  }
+  for ( int y = 0; y < a.ds.get_height(); y++ ) {
+    if ( a.get_row( y )->cells != b.get_row( y )->cells ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* encodes last -> f, sends it through the wire format, applies it to last */
+static void round_trip( const Framebuffer& last, const Framebuffer& f )
+{
+  HostBuffers::FrameUpdate update;
+  encode_frame_update( last, f, update );
+
+  HostBuffers::FrameUpdate received;
+  check( received.ParseFromString( update.SerializeAsString() ), "update parses" );
+
+  Framebuffer applied( last );
+  apply_frame_update( received, applied );
+  check( same_screen( applied, f ), "applied update gives the new frame" );
+}
+
+static void test_frames( int width, int height )
+{
+  Complete complete( width, height );
+
+  for ( int i = 0; i < 200; i++ ) {
+    const Framebuffer last( complete.get_fb() );
+    complete.act( random_output( prng() % ( width * height / 2 ) ) );
+    round_trip( last, complete.get_fb() );
+  }
+}
+
+/* as Complete::diff_from() does, the client resizes before applying */
+static void test_resize( void )
+{
+  Complete complete( 80, 24 );
+  for ( int i = 0; i < 50; i++ ) {
+    Framebuffer last( complete.get_fb() );
+    complete.act( random_output( 500 ) );
+    const int width = prng() % 120 + 1;
+    const int height = prng() % 50 + 1;
+    complete.act( Parser::Resize( width, height ) );
+    complete.act( random_output( 200 ) );
+
+    last.resize( width, height );
+    round_trip( last, complete.get_fb() );
+  }
+}
+
+static void test_no_change( void )
+{
+  Complete complete( 80, 24 );
+  complete.act( random_output( 1000 ) );
+  const Framebuffer same( complete.get_fb() );
+
+  HostBuffers::FrameUpdate update;
+  encode_frame_update( same, complete.get_fb(), update );
+  check( update.ByteSizeLong() == 0, "no change gives an empty update" );
+}
+
+int main()
+{
+  test_frames( 80, 24 );
+  test_frames( 13, 40 );
+  test_frames( 200, 3 );
+  test_resize();
+  test_no_change();
+  return EXIT_SUCCESS;
+}
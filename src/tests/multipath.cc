@@ -0,0 +1,289 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests a multipath client on 127.0.0.1 and 127.0.0.2: urgent datagrams
+   go out on both paths and reach the server exactly once, bulk is
+   spread across them, and the receiver's window of sequence numbers
+   drops copies whether they come in order or not.  The client's
+   datagrams are captured on their way to the server, to be delivered
+   in whatever order a test needs. */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "src/network/network.h"
+#include "test_common.h"
+
+using namespace Network;
+
+/* A socket in the middle, where the client thinks the server is */
+class Capture
+{
+public:
+  int fd;
+  struct sockaddr_in addr;
+  struct sockaddr_in server;
+
+  Capture( const Connection& s_server ) : fd( socket( AF_INET, SOCK_DGRAM, 0 ) ), addr(), server()
+  {
+    check( fd >= 0, "socket" );
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    check( bind( fd, (struct sockaddr*)&addr, sizeof addr ) == 0, "bind" );
+    socklen_t len = sizeof addr;
+    check( getsockname( fd, (struct sockaddr*)&addr, &len ) == 0, "getsockname" );
+
+    struct timeval timeout = { 2, 0 };
+    check( setsockopt( fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout ) == 0, "SO_RCVTIMEO" );
+
+    server = addr;
+    server.sin_port = htons( atoi( s_server.port().c_str() ) );
+  }
+  ~Capture() { close( fd ); }
+
+  std::string port( void ) const { return std::to_string( ntohs( addr.sin_port ) ); }
+
+  /* the next datagram sent here */
+  std::string take( struct sockaddr_in* from = NULL )
+  {
+    char buf[2048];
+    struct sockaddr_in source;
+    socklen_t len = sizeof source;
+    const ssize_t n = recvfrom( fd, buf, sizeof buf, 0, (struct sockaddr*)&source, &len );
+    check( n >= 0, "datagram captured" );
+    if ( from ) {
+      *from = source;
+    }
+    return std::string( buf, n );
+  }
+
+  void forward( const std::string& datagram, const struct sockaddr_in& to )
+  {
+    check( sendto( fd, datagram.data(), datagram.size(), 0, (const struct sockaddr*)&to, sizeof to )
+             == ssize_t( datagram.size() ),
+           "sendto" );
+  }
+
+private:
+  Capture( const Capture& );
+  Capture& operator=( const Capture& );
+};
+
+/* Forwards one datagram to the server; returns the payload the server
+   made of it, or "" if it was dropped as a copy */
+static std::string deliver( Capture& capture, Connection& server, const std::string& datagram )
+{
+  capture.forward( datagram, capture.server );
+  size_t len;
+  const char* payload = server.recv( &len );
+  check( !server.has_queued_datagrams(), "one datagram at a time" );
+  return payload ? std::string( payload, len ) : std::string();
+}
+
+static void send_one( Connection& client, const std::string& payload, bool urgent )
+{
+  struct iovec iov;
+  iov.iov_base = const_cast<char*>( payload.data() );
+  iov.iov_len = payload.size();
+  Connection::Datagram d;
+  d.iov = &iov;
+  d.iovcnt = 1;
+  d.urgent = urgent;
+  client.send( &d, 1 );
+}
+
+static void test_duplicate_window( void )
+{
+  Connection server( "127.0.0.1", NULL );
+  Capture capture( server );
+  Connection client( server.get_key().c_str(), "127.0.0.1", capture.port().c_str() );
+
+  const int COUNT = 100;
+  std::vector<std::string> wire;
+  for ( int i = 0; i < COUNT; i++ ) {
+    client.send( std::to_string( i ) );
+    wire.push_back( capture.take() );
+  }
+
+  /* reordered, and each copy of one already received dropped */
+  const int reordered[] = { 0, 2, 1, 4, 3 };
+  for ( int i : reordered ) {
+    check( deliver( capture, server, wire[i] ) == std::to_string( i ), "reordered datagram delivered" );
+  }
+  check( deliver( capture, server, wire[1] ).empty(), "copy of a late datagram dropped" );
+  check( deliver( capture, server, wire[4] ).empty(), "copy of the newest datagram dropped" );
+
+  /* the rest but two, which come in late */
+  for ( int i = 5; i < COUNT; i++ ) {
+    if ( ( i != 30 ) && ( i != 50 ) ) {
+      check( deliver( capture, server, wire[i] ) == std::to_string( i ), "datagram delivered" );
+    }
+  }
+  check( deliver( capture, server, wire[50] ) == "50", "late datagram inside the window delivered" );
+  check( deliver( capture, server, wire[50] ).empty(), "and its copy dropped" );
+  check( deliver( capture, server, wire[30] ) == "30", "late datagram behind the window delivered" );
+
+  /* copies as far back as the window reaches */
+  const int newest = COUNT - 1;
+  for ( int behind = 0; behind < 64; behind++ ) {
+    check( deliver( capture, server, wire[newest - behind] ).empty(), "copy inside the window dropped" );
+  }
+  check( deliver( capture, server, wire[newest - 64] ) == std::to_string( newest - 64 ),
+         "copies behind the window are left to the transport" );
+}
+
+static bool from( const struct sockaddr_in& source, const char* address )
+{
+  struct in_addr a;
+  inet_pton( AF_INET, address, &a );
+  return source.sin_addr.s_addr == a.s_addr;
+}
+
+static void test_multipath( void )
+{
+  Connection server( "127.0.0.1", NULL );
+  Capture capture( server );
+  Connection client( server.get_key().c_str(), "127.0.0.1", capture.port().c_str() );
+  client.add_path( "127.0.0.2" );
+
+  /* urgent: one copy on each path, and one delivery of the two */
+  struct sockaddr_in path_addr[2];
+  for ( int i = 0; i < 20; i++ ) {
+    const std::string payload = "urgent " + std::to_string( i );
+    send_one( client, payload, true );
+    struct sockaddr_in a, b;
+    std::string copies[2] = { capture.take( &a ), capture.take( &b ) };
+    check( copies[0] == copies[1], "the same datagram on each path" );
+    check( from( a, "127.0.0.1" ) != from( b, "127.0.0.1" ), "one copy per path" );
+    path_addr[0] = from( a, "127.0.0.1" ) ? a : b;
+    path_addr[1] = from( a, "127.0.0.1" ) ? b : a;
+
+    if ( prng() % 2 ) {
+      std::swap( copies[0], copies[1] );
+    }
+    check( deliver( capture, server, copies[0] ) == payload, "first copy delivered" );
+    check( deliver( capture, server, copies[1] ).empty(), "second copy dropped" );
+  }
+
+  /* with no path heard from, bulk takes the primary */
+  send_one( client, "lone", false );
+  struct sockaddr_in source;
+  capture.take( &source );
+  check( from( source, "127.0.0.1" ), "bulk on the primary path before the server answers" );
+
+  /* the server answers on each path */
+  for ( int n = 0; n < 2; n++ ) {
+    server.send( "reply " + std::to_string( n ) );
+    capture.forward( capture.take(), path_addr[n] );
+    check( client.recv() == "reply " + std::to_string( n ), "reply received" );
+    check( client.get_path_stats( n ).received == 1, "reply credited to its path" );
+  }
+
+  /* bulk: a contiguous share on each */
+  const int BATCH = 10;
+  std::string payloads[BATCH];
+  struct iovec iov[BATCH];
+  Connection::Datagram batch[BATCH];
+  for ( int i = 0; i < BATCH; i++ ) {
+    payloads[i] = "bulk " + std::to_string( i );
+    iov[i].iov_base = const_cast<char*>( payloads[i].data() );
+    iov[i].iov_len = payloads[i].size();
+    batch[i].iov = &iov[i];
+    batch[i].iovcnt = 1;
+    batch[i].urgent = false;
+  }
+  client.send( batch, BATCH );
+  int on_second = 0;
+  int switches = 0;
+  bool last_second = false;
+  for ( int i = 0; i < BATCH; i++ ) {
+    capture.take( &source );
+    const bool second = from( source, "127.0.0.2" );
+    on_second += second;
+    switches += ( i > 0 ) && ( second != last_second );
+    last_second = second;
+  }
+  check( on_second == BATCH / 2, "bulk split evenly" );
+  check( switches == 1, "in contiguous shares" );
+
+  /* bulk paced out one datagram at a time takes turns */
+  for ( int i = 0; i < 6; i++ ) {
+    send_one( client, "paced", false );
+    const bool previous_second = last_second;
+    capture.take( &source );
+    last_second = from( source, "127.0.0.2" );
+    check( ( i == 0 ) || ( last_second != previous_second ), "single bulk datagrams alternate paths" );
+  }
+
+  /* an urgent datagram in a batch still goes on both */
+  batch[0].urgent = true;
+  client.send( batch, 3 );
+  on_second = 0;
+  for ( int i = 0; i < 4; i++ ) {
+    capture.take( &source );
+    on_second += from( source, "127.0.0.2" );
+  }
+  check( on_second == 2, "urgent copy and a bulk share on each path" );
+}
+
+int main()
+{
+  test_duplicate_window();
+
+  /* 127.0.0.2 is only on the loopback interface of some systems */
+  int probe = socket( AF_INET, SOCK_DGRAM, 0 );
+  struct sockaddr_in second;
+  memset( &second, 0, sizeof second );
+  second.sin_family = AF_INET;
+  inet_pton( AF_INET, "127.0.0.2", &second.sin_addr );
+  const bool have_second = ( probe >= 0 ) && ( bind( probe, (struct sockaddr*)&second, sizeof second ) == 0 );
+  if ( probe >= 0 ) {
+    close( probe );
+  }
+  if ( !have_second ) {
+    fprintf( stderr, "127.0.0.2 not available, skipping multipath test\n" );
+    return 77;
+  }
+
+  test_multipath();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,192 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that the path MTU search converges on a simulated path's MTU,
+   falls back when probes or full-sized datagrams are lost, and that a
+   server keeps a client's path MTU when the client hops to a new port */
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "src/network/network.h"
+#include "src/network/pathmtu.h"
+#include "test_common.h"
+
+using namespace Network;
+
+static const int MINIMUM = 500;
+static const int BASE = 1252;
+static const int MAXIMUM = 1472;
+
+/* Probes a path that carries datagrams up to path_MTU until the search
+   ends; returns how many probes it took */
+static int search( PathMTU& pmtu, int path_MTU, uint64_t now )
+{
+  int probes = 0;
+  for ( int size = pmtu.probe_size( now ); size != 0; size = pmtu.probe_size( now ) ) {
+    check( ( size > pmtu.get() ) && ( size <= MAXIMUM ), "probes between the MTU and the maximum" );
+    check( ++probes < 100, "search ends" );
+    if ( size <= path_MTU ) {
+      pmtu.probe_acked( size, now );
+    } else {
+      pmtu.probe_lost( size, now );
+    }
+  }
+  return probes;
+}
+
+static void test_convergence( void )
+{
+  std::uniform_int_distribution<int> path_MTUs( BASE, MAXIMUM );
+  for ( int i = 0; i < 1000; i++ ) {
+    const int path_MTU = ( i == 0 ) ? BASE : ( i == 1 ) ? MAXIMUM : path_MTUs( prng );
+    const uint64_t now = 1000;
+    PathMTU pmtu( MINIMUM, BASE, MAXIMUM );
+    check( pmtu.get() == BASE, "starts at the base size" );
+
+    search( pmtu, path_MTU, now );
+    check( pmtu.get() <= path_MTU, "never above the path's MTU" );
+    check( path_MTU - pmtu.get() < PROBE_GRANULARITY, "within the granularity of the path's MTU" );
+
+    /* the next search starts from the top, after the raise timer */
+    check( pmtu.probe_size( now + PMTU_RAISE_TIMER - 1 ) == 0, "quiet after a search" );
+    check( pmtu.probe_size( now + PMTU_RAISE_TIMER ) == MAXIMUM, "searches again later" );
+  }
+
+  /* a clean path takes one probe */
+  PathMTU pmtu( MINIMUM, BASE, MAXIMUM );
+  check( search( pmtu, MAXIMUM, 0 ) == 1, "the maximum is probed first" );
+  check( pmtu.get() == MAXIMUM, "and taken" );
+}
+
+static void test_lost_probes( void )
+{
+  const uint64_t now = 1000;
+  PathMTU pmtu( MINIMUM, BASE, MAXIMUM );
+
+  /* one loss is not enough to give up on a size */
+  const int size = pmtu.probe_size( now );
+  for ( int i = 1; i < MAX_PROBES; i++ ) {
+    pmtu.probe_lost( size, now );
+    check( pmtu.probe_size( now ) == size, "retries a lost probe" );
+  }
+  pmtu.probe_lost( size, now );
+  check( pmtu.probe_size( now ) < size, "gives up after MAX_PROBES" );
+  check( pmtu.get() == BASE, "lost probes leave the MTU" );
+
+  /* the interface refusing a probe caps the search at once */
+  const int smaller = pmtu.probe_size( now );
+  pmtu.probe_too_big( smaller, now );
+  const int next = pmtu.probe_size( now );
+  check( ( next == 0 ) || ( next < smaller ), "a refused probe is too big" );
+
+  /* losses of sizes already decided change nothing */
+  PathMTU decided( MINIMUM, BASE, MAXIMUM );
+  decided.probe_acked( 1400, now );
+  for ( int i = 0; i < MAX_PROBES; i++ ) {
+    decided.probe_lost( 1300, now );
+  }
+  check( decided.get() == 1400, "a smaller size lost after a larger one got through" );
+}
+
+static void test_fallback( void )
+{
+  const uint64_t now = 1000;
+  PathMTU pmtu( MINIMUM, BASE, MAXIMUM );
+
+  /* full-sized datagrams at the base size are not suspect */
+  pmtu.black_hole( now );
+  check( pmtu.get() == BASE, "the base size survives a black hole" );
+
+  search( pmtu, 1400, now );
+  check( pmtu.get() > BASE, "search raised the MTU" );
+  pmtu.black_hole( now );
+  check( pmtu.get() == BASE, "a black hole returns to the base size" );
+  check( pmtu.probe_size( now ) == 0, "and probing waits" );
+  check( pmtu.probe_size( now + PMTU_RAISE_TIMER ) == MAXIMUM, "before searching from the top" );
+
+  /* the path shrank below the base size */
+  pmtu.refused( now );
+  check( pmtu.get() == MINIMUM, "a refused datagram falls back to the minimum" );
+  search( pmtu, BASE + 50, now + PMTU_RAISE_TIMER );
+  check( ( pmtu.get() > BASE ) && ( pmtu.get() <= BASE + 50 ), "and the next search recovers" );
+}
+
+/* Sends from client until server receives payload, past duplicates */
+static void deliver( Connection& client, Connection& server, const std::string& payload )
+{
+  for ( int tries = 0; tries < 100; tries++ ) {
+    client.send( payload );
+    for ( int reads = 0; reads < 100; reads++ ) {
+      size_t len;
+      const char* received;
+      try {
+        received = server.recv( &len );
+      } catch ( const NetworkException& e ) {
+        break;
+      }
+      if ( received && ( std::string( received, len ) == payload ) ) {
+        return;
+      }
+    }
+  }
+  check( false, "datagram delivered" );
+}
+
+static void test_port_hop( void )
+{
+  Connection server( "127.0.0.1", NULL );
+  Connection client( server.get_key().c_str(), "127.0.0.1", server.port().c_str() );
+  deliver( client, server, "before" );
+  const Addr before = server.get_remote_addr();
+
+  const int raised = server.get_MTU() + 100;
+  server.MTU_probe_acked( raised );
+  check( server.get_MTU() == raised, "probe raised the server's MTU" );
+
+  /* the client's new socket, with the session's key */
+  Connection hopped( server.get_key().c_str(), "127.0.0.1", server.port().c_str() );
+  deliver( hopped, server, "after" );
+  check( server.get_remote_addr().sin.sin_port != before.sin.sin_port, "server followed the client to its new port" );
+  check( server.get_MTU() == raised, "the path's MTU survives a port hop" );
+}
+
+int main()
+{
+  test_convergence();
+  test_lost_probes();
+  test_fallback();
+  test_port_hop();
+  return EXIT_SUCCESS;
+}
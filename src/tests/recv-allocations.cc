@@ -0,0 +1,161 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests that, once warmed up, receiving datagrams and reassembling the
+   instructions they carry allocates no memory */
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+
+#include "src/network/network.h"
+#include "src/network/transportfragment.h"
+#include "test_common.h"
+
+using namespace Network;
+
+static const size_t MTU = 500;
+static const int WARMUP = 20;
+static const int ROUNDS = 200;
+
+static size_t allocations = 0;
+
+void* operator new( size_t size )
+{
+  allocations++;
+  void* p = malloc( size ? size : 1 );
+  if ( p == NULL ) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void operator delete( void* p ) noexcept
+{
+  free( p );
+}
+
+void operator delete( void* p, size_t ) noexcept
+{
+  free( p );
+}
+
+static Instruction make_instruction( uint64_t num )
+{
+  /* a few sizes, half of them random so they don't compress */
+  static const size_t sizes[] = { 20, 300, 1500, 4000 };
+  const size_t diff_len = sizes[num % 4];
+  std::string diff( diff_len, 0 );
+  for ( size_t i = 0; i < diff_len; i++ ) {
+    diff[i] = ( num & 4 ) ? prng() : 'a' + i % 7;
+  }
+
+  Instruction inst;
+  inst.set_protocol_version( MOSH_PROTOCOL_VERSION );
+  inst.set_old_num( num );
+  inst.set_new_num( num + 1 );
+  inst.set_ack_num( num );
+  inst.set_throwaway_num( num );
+  inst.set_diff( diff );
+  return inst;
+}
+
+/* Sends an instruction's fragments, but the first of several, so
+   parity has to rebuild it */
+static void send_instruction( Connection& client, const std::vector<FragmentView>& fragments )
+{
+  std::vector<std::string> packets;
+  for ( size_t i = ( fragments.size() > 1 ) ? 1 : 0; i < fragments.size(); i++ ) {
+    char header[Fragment::frag_header_len];
+    fragments[i].write_header( header );
+    packets.push_back( std::string( header, sizeof( header ) )
+                       + std::string( fragments[i].data, fragments[i].len ) );
+  }
+
+  for ( size_t i = 0; i < packets.size(); i++ ) {
+    client.send( packets[i] );
+  }
+}
+
+/* Receives until the instruction is complete; returns it */
+static const Instruction& receive_instruction( Connection& server, int fd, FragmentAssembly& assembly )
+{
+  while ( true ) {
+    if ( !server.has_queued_datagrams() ) {
+      struct pollfd pfd = { fd, POLLIN, 0 };
+      check( poll( &pfd, 1, 5000 ) == 1, "datagrams arrive" );
+    }
+
+    size_t len;
+    const char* payload = server.recv( &len );
+    FragmentView frag( payload, len );
+    if ( assembly.add_fragment( frag ) ) {
+      return assembly.get_assembly();
+    }
+  }
+}
+
+int main()
+{
+  Connection server( "127.0.0.1", NULL );
+  Connection client( server.get_key().c_str(), "127.0.0.1", server.port().c_str() );
+  const int fd = server.fds().back();
+
+  Fragmenter fragmenter;
+  FragmentAssembly assembly;
+  fragmenter.set_remote_capabilities( CAPABILITY_PARITY );
+  fragmenter.set_parity_group( 4 );
+
+  size_t steady_allocations = 0;
+  for ( int round = 0; round < ROUNDS; round++ ) {
+    const Instruction inst = make_instruction( round );
+    send_instruction( client, fragmenter.make_fragments( inst, MTU ) );
+
+    const size_t before = allocations;
+    const Instruction& received = receive_instruction( server, fd, assembly );
+    if ( round >= WARMUP ) {
+      steady_allocations += allocations - before;
+    }
+
+    check( received.SerializeAsString() == inst.SerializeAsString(), "contents match" );
+  }
+
+  printf( "%d instructions received with %lu allocations after warmup\n",
+          ROUNDS - WARMUP,
+          (unsigned long)steady_allocations );
+  check( steady_allocations == 0, "steady state receive path allocates nothing" );
+  return EXIT_SUCCESS;
+}
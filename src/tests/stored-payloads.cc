@@ -0,0 +1,162 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests stored payloads: with CAPABILITY_STORED, payloads under
+   STORED_THRESHOLD and those that would grow are sent as they are
+   behind a tag byte, and counted for --verbose; without it, every
+   payload is compressed. */
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "src/network/compressor.h"
+#include "src/network/network.h"
+#include "test_common.h"
+
+using namespace Network;
+
+static bool is_stored( const std::string& payload )
+{
+  return !payload.empty() && ( payload[0] == '\0' );
+}
+
+/* zlib streams have deflate (8) in the low nibble of their first byte */
+static bool is_zlib( const std::string& payload )
+{
+  return !payload.empty() && ( ( payload[0] & 0x0f ) == 8 );
+}
+
+static std::string random_bytes( size_t len )
+{
+  std::string out;
+  while ( out.size() < len ) {
+    out.push_back( char( prng() ) );
+  }
+  return out;
+}
+
+/* also checks the receiver hands back the payload in place */
+static void check_round_trip( const std::string& sent, const std::string& payload, const char* what )
+{
+  Compressor& compressor = get_compressor();
+  const uint64_t received_stored = compressor.get_counters().received_stored;
+  size_t len;
+  const char* out = compressor.uncompress( sent.data(), sent.size(), &len );
+  check( ( len == payload.size() ) && ( std::string( out, len ) == payload ), what );
+  if ( is_stored( sent ) ) {
+    check( out == sent.data() + 1, "stored payloads are not copied" );
+    check( compressor.get_counters().received_stored == received_stored + 1, "stored payload counted" );
+  } else {
+    check( compressor.get_counters().received_stored == received_stored, "compressed payload not counted" );
+  }
+}
+
+static void test_small( void )
+{
+  Compressor& compressor = get_compressor();
+  for ( size_t len = 0; len < STORED_THRESHOLD; len++ ) {
+    /* even a payload that compresses well */
+    const std::string payload( len, 'x' );
+    const Compressor::Counters before = compressor.get_counters();
+    const std::string sent = compressor.compress_str( payload, CAPABILITY_STORED );
+    const Compressor::Counters& after = compressor.get_counters();
+    check( is_stored( sent ) && ( sent.size() == len + 1 ), "small payload stored" );
+    check( after.sent_stored_small == before.sent_stored_small + 1, "small payload counted" );
+    check( after.sent_stored_small_bytes == before.sent_stored_small_bytes + len, "small payload bytes counted" );
+    check( after.sent_stored_incompressible == before.sent_stored_incompressible, "small is not incompressible" );
+    check_round_trip( sent, payload, "small payload round-trips" );
+  }
+
+  const std::string payload( STORED_THRESHOLD, 'x' );
+  const std::string sent = compressor.compress_str( payload, CAPABILITY_STORED );
+  check( is_zlib( sent ), "payload at the threshold compressed" );
+  check_round_trip( sent, payload, "payload at the threshold round-trips" );
+}
+
+static void test_incompressible( void )
+{
+  Compressor& compressor = get_compressor();
+  for ( size_t len = STORED_THRESHOLD; len < 200000; len = len * 2 + 1 ) {
+    const std::string payload = random_bytes( len );
+    const size_t compressed = compressor.compress_str( payload, 0 ).size();
+    check( compressed > len, "random bytes grow under compression" );
+
+    const Compressor::Counters before = compressor.get_counters();
+    const std::string sent = compressor.compress_str( payload, CAPABILITY_STORED );
+    const Compressor::Counters& after = compressor.get_counters();
+    check( is_stored( sent ) && ( sent.size() == len + 1 ), "incompressible payload stored" );
+    check( after.sent_stored_incompressible == before.sent_stored_incompressible + 1,
+           "incompressible payload counted" );
+    check( after.stored_bytes_saved == before.stored_bytes_saved + ( compressed - ( len + 1 ) ),
+           "bytes saved counted" );
+    check( after.sent_stored_small == before.sent_stored_small, "incompressible is not small" );
+    check_round_trip( sent, payload, "incompressible payload round-trips" );
+
+    /* terminal output of the same size still shrinks */
+    const std::string text = random_output( len );
+    const std::string text_sent = compressor.compress_str( text, CAPABILITY_STORED );
+    check( is_zlib( text_sent ) && ( text_sent.size() < text.size() ), "compressible payload compressed" );
+    check_round_trip( text_sent, text, "compressible payload round-trips" );
+  }
+}
+
+/* peers that never advertised CAPABILITY_STORED get compressed output */
+static void test_no_capability( void )
+{
+  Compressor& compressor = get_compressor();
+  const uint32_t without_stored[]
+    = { 0, CAPABILITY_DEFLATE_DICTIONARY, compressor.capabilities() & ~CAPABILITY_STORED };
+  for ( size_t i = 0; i < sizeof( without_stored ) / sizeof( without_stored[0] ); i++ ) {
+    for ( size_t len = 0; len < 100000; len = len * 2 + 1 ) {
+      const std::string payloads[] = { std::string( len, 'x' ), random_bytes( len ) };
+      for ( size_t j = 0; j < sizeof( payloads ) / sizeof( payloads[0] ); j++ ) {
+        const Compressor::Counters before = compressor.get_counters();
+        const std::string sent = compressor.compress_str( payloads[j], without_stored[i] );
+        const Compressor::Counters& after = compressor.get_counters();
+        check( !is_stored( sent ), "nothing stored without the capability" );
+        check( ( after.sent_stored_small == before.sent_stored_small )
+                 && ( after.sent_stored_incompressible == before.sent_stored_incompressible ),
+               "nothing counted as stored without the capability" );
+        check_round_trip( sent, payloads[j], "compressed payload round-trips" );
+      }
+    }
+  }
+}
+
+int main()
+{
+  test_small();
+  test_incompressible();
+  test_no_capability();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "test_common.h"
+
+std::mt19937 prng( 1 );
+
+void check( bool condition, const char* what )
+{
+  if ( !condition ) {
+    fprintf( stderr, "FAILED: %s\n", what );
+    exit( EXIT_FAILURE );
+  }
+}
+
+std::string random_output( size_t len )
+{
+  static const char* const controls[] = {
+    "\033[1m",     "\033[0m",     "\033[7m",         "\033[31m",       "\033[42;33m", "\033[38;5;200m",
+    "\033[K",      "\033[2J",     "\033[H",          "\033[10;20H",    "\033[4;1H",   "\033[3A",
+    "\033[5B",     "\r\n",        "\n\n\n",          "\033[L",         "\033[2M",     "\033[3S",
+    "\033[2T",     "\033[5;12r",  "\033[r",          "\033[?25l",      "\033[?25h",   "\033[?5h",
+    "\033[?5l",    "\033[?2004h", "\033[?1000h",     "\033[?1006h",    "\033[?1049h", "\033[?1049l",
+    "\033]0;title\007",           "\033]1;icon\007", "\033]8;;http://example.com/\033\\",
+    "\033]8;;\033\\",             "\033[48;2;1;2;3m", "\007",          "\xc3\xa9",    "\xe4\xb8\xad",
+    "e\xcc\x81",   "\t",
+  };
+  const size_t control_count = sizeof( controls ) / sizeof( controls[0] );
+
+  std::string out;
+  while ( out.size() < len ) {
+    if ( prng() % 4 == 0 ) {
+      out += controls[prng() % control_count];
+    } else {
+      out.append( prng() % 100 + 1, 'a' + prng() % 26 );
+    }
+  }
+  return out;
+}
@@ -0,0 +1,245 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+/* Tests UserStream's chunked representation against a plain string of
+   events: subtracting part of a chunk, resizes between byte runs, diffs
+   that start and end across chunk boundaries, and a large paste */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "src/statesync/user.h"
+#include "src/terminal/parseraction.h"
+#include "test_common.h"
+
+using Network::UserStream;
+
+/* UserStream's cap on a byte run */
+static const size_t CHUNK_SIZE = 4096;
+
+/* the stream's events as a string, resizes written as <width,height> */
+static std::string events( const UserStream& stream )
+{
+  std::string out;
+  size_t total = 0;
+  for ( size_t i = 0; i < stream.chunk_count(); i++ ) {
+    const Network::UserChunk& chunk = stream.get_chunk( i );
+    if ( chunk.type == Network::UserByteType ) {
+      check( !chunk.bytes.empty() && chunk.bytes.size() <= CHUNK_SIZE, "byte runs are non-empty and capped" );
+      out += chunk.bytes;
+    } else {
+      char buf[32];
+      snprintf( buf, sizeof( buf ), "<%lu,%lu>", (unsigned long)chunk.resize.width,
+                (unsigned long)chunk.resize.height );
+      out += buf;
+    }
+    total += chunk.size();
+  }
+  check( total == stream.size(), "event count matches the chunks" );
+  return out;
+}
+
+static void type( UserStream& stream, const std::string& s )
+{
+  for ( std::string::const_iterator i = s.begin(); i != s.end(); i++ ) {
+    stream.push_back( Parser::UserByte( *i ) );
+  }
+}
+
+static std::string letters( size_t len )
+{
+  std::string s;
+  for ( size_t i = 0; i < len; i++ ) {
+    s.push_back( 'a' + prng() % 26 );
+  }
+  return s;
+}
+
+/* the receiver holds existing, applies the diff, and must end up equal */
+static void round_trip( const UserStream& existing, const UserStream& current, const char* what )
+{
+  UserStream receiver( existing );
+  receiver.apply_string( current.diff_from( existing ) );
+  check( receiver == current, what );
+  check( events( receiver ) == events( current ), what );
+}
+
+/* the first n events of stream */
+static UserStream first_events( const UserStream& stream, size_t n )
+{
+  UserStream out;
+  for ( size_t i = 0; ( i < stream.chunk_count() ) && ( out.size() < n ); i++ ) {
+    const Network::UserChunk& chunk = stream.get_chunk( i );
+    if ( chunk.type == Network::ResizeType ) {
+      out.push_back( chunk.resize );
+    } else {
+      type( out, chunk.bytes.substr( 0, n - out.size() ) );
+    }
+  }
+  return out;
+}
+
+static void test_split_subtract( void )
+{
+  const std::string text = letters( 2 * CHUNK_SIZE + 100 );
+  UserStream stream;
+  type( stream, text );
+  check( stream.chunk_count() == 3, "bytes fill chunks of CHUNK_SIZE" );
+
+  /* a prefix ending inside the first chunk, then inside the last */
+  const size_t cuts[] = { 1, CHUNK_SIZE - 1, CHUNK_SIZE, CHUNK_SIZE + 1, 2 * CHUNK_SIZE + 99 };
+  for ( size_t i = 0; i < sizeof( cuts ) / sizeof( cuts[0] ); i++ ) {
+    UserStream copy( stream );
+    UserStream prefix;
+    type( prefix, text.substr( 0, cuts[i] ) );
+    copy.subtract( &prefix );
+    check( copy.size() == text.size() - cuts[i], "subtract removes the prefix's events" );
+    check( events( copy ) == text.substr( cuts[i] ), "subtract keeps the rest of a split chunk" );
+
+    UserStream rest;
+    type( rest, text.substr( cuts[i] ) );
+    check( copy == rest, "split chunks compare equal to their contents" );
+
+    /* a stream typed further, then trimmed the same way, still diffs
+       against the trimmed state, as the transport relies on */
+    UserStream longer( stream );
+    type( longer, "tail" );
+    longer.subtract( &prefix );
+    round_trip( copy, longer, "diff after subtracting a split prefix" );
+  }
+
+  UserStream self( stream );
+  self.subtract( &self );
+  check( self.empty() && self.chunk_count() == 0, "subtracting itself empties the stream" );
+}
+
+static void test_resizes( void )
+{
+  UserStream stream;
+  type( stream, "abc" );
+  stream.push_back( Parser::Resize( 80, 24 ) );
+  stream.push_back( Parser::Resize( 100, 30 ) );
+  type( stream, "def" );
+  check( stream.chunk_count() == 4, "a resize ends a byte run" );
+  check( stream.size() == 8, "a resize is one event" );
+  check( events( stream ) == "abc<80,24><100,30>def", "resizes sit between byte runs" );
+
+  UserStream other;
+  type( other, "abc" );
+  other.push_back( Parser::Resize( 80, 25 ) );
+  other.push_back( Parser::Resize( 100, 30 ) );
+  type( other, "def" );
+  check( !( stream == other ), "resizes of different size differ" );
+
+  /* every split point, including between the two resizes */
+  for ( size_t cut = 0; cut <= stream.size(); cut++ ) {
+    const UserStream prefix = first_events( stream, cut );
+    check( prefix.size() == cut, "prefix has cut events" );
+
+    round_trip( prefix, stream, "diff from a prefix ending at every event" );
+
+    UserStream copy( stream );
+    copy.subtract( &prefix );
+    check( copy.size() == stream.size() - cut, "subtract across resizes" );
+    check( events( prefix ) + events( copy ) == events( stream ), "subtract removes exactly the prefix" );
+  }
+}
+
+static void test_chunk_boundaries( void )
+{
+  UserStream current;
+  std::string expected;
+  for ( int i = 0; i < 6; i++ ) {
+    const std::string run = letters( CHUNK_SIZE - 3 + prng() % 7 );
+    type( current, run );
+    expected += run;
+    if ( i % 2 ) {
+      current.push_back( Parser::Resize( 80 + i, 24 ) );
+      expected += "<" + std::to_string( 80 + i ) + ",24>";
+    }
+  }
+  check( events( current ) == expected, "runs and resizes are kept in order" );
+
+  check( current.chunk_count() > 6, "runs straddle the cap" );
+
+  UserStream receiver;
+  receiver.apply_string( current.diff_from( UserStream() ) );
+  check( receiver == current, "init diff round trip" );
+
+  /* the existing state ends on, next to, and inside chunk boundaries */
+  for ( size_t cut = 0; cut <= current.size(); cut += ( cut % CHUNK_SIZE < 3 ) ? 1 : CHUNK_SIZE / 2 - 1 ) {
+    round_trip( first_events( current, cut ), current, "diff across chunk boundaries" );
+  }
+}
+
+static void test_large_paste( void )
+{
+  const size_t len = 1 << 20;
+  const std::string paste = letters( len );
+  UserStream stream;
+  type( stream, "vi\r" );
+  type( stream, paste );
+  check( stream.size() == len + 3, "a paste is one event per byte" );
+  check( stream.chunk_count() == len / CHUNK_SIZE + 1, "a paste is chunked" );
+
+  UserStream receiver;
+  receiver.apply_string( stream.diff_from( UserStream() ) );
+  check( receiver == stream, "a paste survives a round trip" );
+
+  /* sent and acknowledged a piece at a time */
+  UserStream acked;
+  UserStream sender( stream );
+  size_t done = 0;
+  while ( done < stream.size() ) {
+    const size_t n = std::min( stream.size() - done, (size_t)( prng() % 100000 + 1 ) );
+    UserStream next( acked );
+    type( next, ( "vi\r" + paste ).substr( done, n ) );
+    round_trip( acked, next, "a piece of the paste" );
+    acked = next;
+    done += n;
+  }
+  check( acked == stream, "pieces add up to the paste" );
+
+  sender.subtract( &acked );
+  check( sender.empty(), "acknowledging the whole paste empties the stream" );
+}
+
+int main()
+{
+  test_split_subtract();
+  test_resizes();
+  test_chunk_boundaries();
+  test_large_paste();
+  return EXIT_SUCCESS;
+}
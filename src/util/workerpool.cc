@@ -0,0 +1,137 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#include "src/include/config.h"
+
+#include <algorithm>
+#include <csignal>
+#include <system_error>
+
+#if HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "src/util/fatal_assert.h"
+#include "src/util/workerpool.h"
+
+WorkerPool::WorkerPool()
+  : workers(), mutex(), work_ready(), batch_done(), batch( NULL ), next_job( 0 ), unfinished_jobs( 0 ),
+    failure(), shutting_down( false )
+{
+#if HAVE_PTHREAD
+  const unsigned int threads = std::min( std::thread::hardware_concurrency(), MAX_THREADS );
+  if ( threads <= 1 ) {
+    return;
+  }
+
+  /* new threads inherit our signal mask */
+  sigset_t all_signals, saved_mask;
+  fatal_assert( 0 == sigfillset( &all_signals ) );
+  fatal_assert( 0 == pthread_sigmask( SIG_SETMASK, &all_signals, &saved_mask ) );
+  try {
+    while ( workers.size() + 1 < threads ) {
+      workers.emplace_back( &WorkerPool::work, this );
+    }
+  } catch ( const std::system_error& ) {
+    /* make do with the threads we got */
+  }
+  fatal_assert( 0 == pthread_sigmask( SIG_SETMASK, &saved_mask, NULL ) );
+#endif
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock( mutex );
+    shutting_down = true;
+  }
+  work_ready.notify_all();
+  for ( std::vector<std::thread>::iterator i = workers.begin(); i != workers.end(); i++ ) {
+    i->join();
+  }
+}
+
+void WorkerPool::run( const std::vector<job_type>& jobs )
+{
+  std::unique_lock<std::mutex> lock( mutex );
+  batch = &jobs;
+  next_job = 0;
+  unfinished_jobs = jobs.size();
+  failure = nullptr;
+  work_ready.notify_all();
+
+  while ( next_job < batch->size() ) {
+    run_job( lock );
+  }
+  batch_done.wait( lock, [this] { return unfinished_jobs == 0; } );
+  batch = NULL;
+
+  if ( failure ) {
+    std::exception_ptr first_failure = failure;
+    failure = nullptr;
+    std::rethrow_exception( first_failure );
+  }
+}
+
+/* Called with the lock held and a job left to take; returns with the lock held. */
+void WorkerPool::run_job( std::unique_lock<std::mutex>& lock )
+{
+  const job_type& job = ( *batch )[next_job++];
+  std::exception_ptr caught;
+
+  lock.unlock();
+  try {
+    job();
+  } catch ( ... ) {
+    caught = std::current_exception();
+  }
+  lock.lock();
+
+  if ( caught && !failure ) {
+    failure = caught;
+  }
+  if ( --unfinished_jobs == 0 ) {
+    batch_done.notify_one();
+  }
+}
+
+void WorkerPool::work( void )
+{
+  std::unique_lock<std::mutex> lock( mutex );
+  while ( true ) {
+    work_ready.wait( lock, [this] { return shutting_down || ( batch && next_job < batch->size() ); } );
+    if ( shutting_down ) {
+      return;
+    }
+    run_job( lock );
+  }
+}
@@ -0,0 +1,90 @@
+/*
+    Mosh: the mobile shell
+    Copyright 2012 Keith Winstein
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    In addition, as a special exception, the copyright holders give
+    permission to link the code of portions of this program with the
+    OpenSSL library under certain conditions as described in each
+    individual source file, and distribute linked combinations including
+    the two.
+
+    You must obey the GNU General Public License in all respects for all
+    of the code used other than OpenSSL. If you modify file(s) with this
+    exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do
+    so, delete this exception statement from your version. If you delete
+    this exception statement from all source files in the program, then
+    also delete it here.
+*/
+
+#ifndef WORKERPOOL_HPP
+#define WORKERPOOL_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* A few threads that run batches of independent jobs.  The calling
+   thread works on the batch too, and run() returns once every job
+   has finished.
+
+   Workers block all signals, so signals are still delivered to the
+   main thread during Select::select(). */
+
+class WorkerPool
+{
+public:
+  using job_type = std::function<void( void )>;
+
+  static WorkerPool& get_instance( void )
+  {
+    static WorkerPool instance;
+    return instance;
+  }
+
+  /* threads available to a batch, counting the caller */
+  unsigned int size( void ) const { return workers.size() + 1; }
+
+  /* Runs every job, rethrowing the first exception any of them threw. */
+  void run( const std::vector<job_type>& jobs );
+
+private:
+  static const unsigned int MAX_THREADS = 4;
+
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable work_ready, batch_done;
+
+  const std::vector<job_type>* batch;
+  size_t next_job, unfinished_jobs;
+  std::exception_ptr failure;
+  bool shutting_down;
+
+  WorkerPool();
+  ~WorkerPool();
+
+  void work( void );
+  void run_job( std::unique_lock<std::mutex>& lock );
+
+  /* not implemented */
+  WorkerPool( const WorkerPool& );
+  WorkerPool& operator=( const WorkerPool& );
+};
+
+#endif